@@ -0,0 +1,109 @@
+//
+// Class ConcurrentQueue implements a lock-free queue for many producers and a single consumer.
+//
+
+// Template parameter T is type of values stored in queue, it must be move-constructable. If IsSingleProducer is true,
+// push_back and emplace_back must not be called simultaneously, which saves an atomic read-modify-write per push.
+// Allocator is an allocator type for T, the line std::allocator_traits<Allocator>::rebind_alloc<Node> should compile.
+// Allocator is called from producer threads (allocate) and the consumer thread (deallocate) simultaneously, so it must
+// be thread-safe. std::allocator is, PoolAllocator is not.
+
+// MpscQueue and SpscQueue are aliases for multi-producer and single-producer queues.
+
+// push_back and emplace_back may be called from any number of threads. try_pop_front, drain and empty must be called
+// from only one thread at a time (the consumer). Constructor and destructor must not run simultaneously with other
+// functions.
+
+// Like List, ConcurrentQueue is made of nodes inherited from NodeBase, but they are linked only through an atomic
+// "next" pointer. The queue always contains one node without a value called dummy, head_ points to it, and values are
+// stored in nodes after it. Initially the dummy is "stub_", a NodeBase owned by the queue itself. tail_ points to the
+// last node. A producer exchanges tail_ with its new node and then links the previous tail to it, so a push is
+// wait-free. The consumer moves the value out of the node after the dummy, which then becomes the new dummy, and
+// deallocates the old dummy.
+
+// Nodes are deallocated only by the consumer, and a node is deallocated only after its "next" was set by the producer,
+// which linked the node after it. No producer accesses a node after setting its "next", so nodes can be safely
+// reclaimed without hazard pointers or epochs.
+
+// Between the exchange of tail_ and the linking of previous tail a producer is "in flight": the consumer cannot see its
+// value and values pushed after it yet. try_pop_front then returns false, as if queue was empty, and drain returns the
+// values before it. The consumer never waits for a producer.
+
+
+#pragma once
+
+#include <memory>
+#include <atomic>
+
+//
+// DECLARATIONS
+//
+
+template <typename T, bool IsSingleProducer = false, typename Allocator = std::allocator<T>>
+class ConcurrentQueue {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  ConcurrentQueue();
+  explicit ConcurrentQueue(const Allocator& alloc);
+  ConcurrentQueue(const ConcurrentQueue& other) = delete;
+  ConcurrentQueue& operator=(const ConcurrentQueue& other) = delete;
+
+  ~ConcurrentQueue() noexcept;
+
+  template <typename... Args_t>
+  void emplace_back(Args_t&& ...args);
+
+  void push_back(const T& value);
+  void push_back(T&& value);
+
+  bool try_pop_front(T& value);
+
+  template <typename Function>
+  size_t drain(Function function);
+
+  bool empty() const noexcept;
+
+ private:
+  struct Node;
+  struct NodeBase;
+
+  void ReplaceDummy(NodeBase* new_dummy) noexcept;
+
+  static Node* AsNode(NodeBase* node_base);
+
+  using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+  // Producers and the consumer work with different ends of queue, which are kept in different cache lines
+  static constexpr size_t kCacheLineSize = 64;
+
+  alignas(kCacheLineSize) std::atomic<NodeBase*> tail_;
+  alignas(kCacheLineSize) NodeBase* head_;
+  NodeBase stub_;
+  NodeAllocator alloc_;
+};
+
+template <typename T, bool IsSingleProducer, typename Allocator>
+struct ConcurrentQueue<T, IsSingleProducer, Allocator>::NodeBase {
+  std::atomic<NodeBase*> next = nullptr;
+
+  NodeBase();
+};
+
+template <typename T, bool IsSingleProducer, typename Allocator>
+struct ConcurrentQueue<T, IsSingleProducer, Allocator>::Node : public NodeBase {
+  T value;
+
+  template <typename... Args_t>
+  explicit Node(Args_t&& ...args);
+};
+
+template <typename T, typename Allocator = std::allocator<T>>
+using MpscQueue = ConcurrentQueue<T, false, Allocator>;
+
+template <typename T, typename Allocator = std::allocator<T>>
+using SpscQueue = ConcurrentQueue<T, true, Allocator>;
+
+#include "concurrent_queue.ipp"
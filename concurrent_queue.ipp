@@ -0,0 +1,184 @@
+//
+// This is a .ipp file for concurrent_queue.hpp. For more information check concurrent_queue.hpp.
+//
+
+//
+// NODE CONSTRUCTORS
+//
+
+/**
+ * Default constructor
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+ConcurrentQueue<T, IsSingleProducer, Allocator>::NodeBase::NodeBase() {}
+
+/**
+ * Constructor, that constructs value in node from args.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+template <typename... Args_t>
+ConcurrentQueue<T, IsSingleProducer, Allocator>::Node::Node(Args_t&& ...args) : value(std::forward<Args_t>(args)...) {
+}
+
+//
+// CONCURRENT QUEUE CONSTRUCTORS
+//
+
+/**
+ * Constructs empty queue, its dummy is stub_.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+ConcurrentQueue<T, IsSingleProducer, Allocator>::ConcurrentQueue()
+    : tail_(&stub_), head_(&stub_), alloc_(NodeAllocator()) {}
+
+/**
+ * Constructs empty queue with given allocator, its dummy is stub_.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+ConcurrentQueue<T, IsSingleProducer, Allocator>::ConcurrentQueue(const Allocator& alloc)
+    : tail_(&stub_), head_(&stub_), alloc_(NodeAllocator(alloc)) {}
+
+//
+// CONCURRENT QUEUE DESTRUCTOR
+//
+
+/**
+ * Destroys all values left in queue and deallocates all nodes. Must not be called while other threads use queue.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+ConcurrentQueue<T, IsSingleProducer, Allocator>::~ConcurrentQueue() noexcept {
+  NodeBase* next = head_->next.load(std::memory_order_acquire);
+  while (next != nullptr) {
+    NodeAllocatorTraits::destroy(alloc_, &AsNode(next)->value);
+    ReplaceDummy(next);
+    next = head_->next.load(std::memory_order_acquire);
+  }
+  ReplaceDummy(&stub_);
+}
+
+//
+// CONCURRENT QUEUE FUNCTIONS
+//
+
+/**
+ * Constructs value from args at the back of queue. May be called from any number of threads simultaneously, unless
+ * IsSingleProducer is true. Wait-free, except for the allocation of node.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+template <typename... Args_t>
+void ConcurrentQueue<T, IsSingleProducer, Allocator>::emplace_back(Args_t&& ...args) {
+  Node* node = NodeAllocatorTraits::allocate(alloc_, 1);
+  try {
+    NodeAllocatorTraits::construct(alloc_, node, std::forward<Args_t>(args)...);
+  } catch (...) {
+    NodeAllocatorTraits::deallocate(alloc_, node, 1);
+    throw;
+  }
+
+  NodeBase* prev_tail;
+  if constexpr (IsSingleProducer) {
+    prev_tail = tail_.load(std::memory_order_relaxed);
+    tail_.store(node, std::memory_order_release);
+  } else {
+    prev_tail = tail_.exchange(node, std::memory_order_acq_rel);
+  }
+  // from now on the consumer may see value, and prev_tail may be deallocated by it
+  prev_tail->next.store(node, std::memory_order_release);
+}
+
+/**
+ * Pushes copy of value to the back of queue. See emplace_back.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+void ConcurrentQueue<T, IsSingleProducer, Allocator>::push_back(const T& value) {
+  emplace_back(value);
+}
+
+/**
+ * Moves value to the back of queue. See emplace_back.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+void ConcurrentQueue<T, IsSingleProducer, Allocator>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+/**
+ * Moves the front value of queue to value and removes it from queue. Must be called only by the consumer.
+ *
+ * @param value Where the front value is moved to
+ * @return True if value was popped, false if queue is empty or the next value is not linked by its producer yet
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+bool ConcurrentQueue<T, IsSingleProducer, Allocator>::try_pop_front(T& value) {
+  NodeBase* next = head_->next.load(std::memory_order_acquire);
+  if (next == nullptr) {
+    return false;
+  }
+
+  value = std::move(AsNode(next)->value);
+  NodeAllocatorTraits::destroy(alloc_, &AsNode(next)->value);
+  ReplaceDummy(next);
+  return true;
+}
+
+/**
+ * Removes values, pushed before the call, from queue and passes them to function in order. The batch is bounded by
+ * one atomic load of tail_, producers are not slowed down by draining. Stops at the first value whose producer is
+ * still in flight, as try_pop_front does: that value and the ones after it are left for the next call. Must be called
+ * only by the consumer.
+ *
+ * @tparam Function Type of function, which must be callable with T&&
+ * @param function Function to be called with every value
+ * @return Number of removed values
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+template <typename Function>
+size_t ConcurrentQueue<T, IsSingleProducer, Allocator>::drain(Function function) {
+  NodeBase* last = tail_.load(std::memory_order_acquire);
+
+  size_t count = 0;
+  while (head_ != last) {
+    NodeBase* next = head_->next.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      break;
+    }
+
+    function(std::move(AsNode(next)->value));
+    NodeAllocatorTraits::destroy(alloc_, &AsNode(next)->value);
+    ReplaceDummy(next);
+    ++count;
+  }
+  return count;
+}
+
+/**
+ * Returns true if the consumer cannot pop a value now. Must be called only by the consumer.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+bool ConcurrentQueue<T, IsSingleProducer, Allocator>::empty() const noexcept {
+  return head_->next.load(std::memory_order_acquire) == nullptr;
+}
+
+/**
+ * Makes new_dummy, whose value is already destroyed, the dummy of queue and deallocates the old dummy, unless it is
+ * stub_.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+void ConcurrentQueue<T, IsSingleProducer, Allocator>::ReplaceDummy(NodeBase* new_dummy) noexcept {
+  NodeBase* old_dummy = head_;
+  head_ = new_dummy;
+  if (old_dummy != &stub_) {
+    NodeAllocatorTraits::deallocate(alloc_, AsNode(old_dummy), 1);
+  }
+}
+
+/**
+ * Unsafe cast from base class pointer NodeBase* to derived Node*.
+ */
+template <typename T, bool IsSingleProducer, typename Allocator>
+typename ConcurrentQueue<T, IsSingleProducer, Allocator>::Node* ConcurrentQueue<T,
+                                                                                IsSingleProducer,
+                                                                                Allocator>::AsNode(
+    NodeBase* node_base) {
+  return static_cast<Node*>(node_base);
+}
@@ -0,0 +1,469 @@
+#include "../../list.hpp"
+#include "../../pool_allocator.hpp"
+#include "../../unrolled_list.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <list>
+#include <optional>
+#include <string>
+#include <vector>
+
+// Value type of 64 bytes without constructors
+struct Pod64 {
+  int64_t values[8];
+
+  bool operator==(const Pod64& other) const {
+    return std::memcmp(values, other.values, sizeof(values)) == 0;
+  }
+};
+
+struct Result {
+  std::string container;
+  std::string type;
+  std::string operation;
+  size_t size;
+  size_t repetitions;
+  size_t operations;
+  double ns_per_operation;
+};
+
+struct MemoryResult {
+  std::string container;
+  std::string type;
+  size_t size;
+  double bytes_per_element;
+};
+
+// Every measured operation works with its own State, prepared before measuring
+template <typename Container>
+struct State {
+  Container container;
+  std::optional<Container> target;
+  std::optional<typename Container::iterator> first;
+  std::optional<typename Container::iterator> last;
+};
+
+struct Options {
+  size_t max_size = 10000000;
+  std::string output_path;
+};
+
+Options ParseOptions(int argc, char** argv);
+void WriteJson(std::ostream& out, const std::vector<Result>& results, const std::vector<MemoryResult>& memory_results);
+template <typename T>
+void RunForType(const std::string& type_name,
+                const Options& options,
+                std::vector<Result>& results,
+                std::vector<MemoryResult>& memory_results);
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+
+  std::vector<Result> results;
+  std::vector<MemoryResult> memory_results;
+  RunForType<int>("int", options, results, memory_results);
+  RunForType<std::string>("std::string", options, results, memory_results);
+  RunForType<Pod64>("pod64", options, results, memory_results);
+
+  if (options.output_path.empty()) {
+    WriteJson(std::cout, results, memory_results);
+  } else {
+    std::ofstream out(options.output_path);
+    WriteJson(out, results, memory_results);
+  }
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--max-size", SizeOption(options.max_size)},
+                            {"--output", StringOption(options.output_path)}});
+  return options;
+}
+
+//
+// VALUES
+//
+
+template <typename T>
+T MakeValue(size_t index);
+
+template <>
+int MakeValue<int>(size_t index) {
+  return static_cast<int>(index);
+}
+
+template <>
+std::string MakeValue<std::string>(size_t index) {
+  return "message number " + std::to_string(index);
+}
+
+template <>
+Pod64 MakeValue<Pod64>(size_t index) {
+  Pod64 value{};
+  std::fill(std::begin(value.values), std::end(value.values), static_cast<int64_t>(index));
+  return value;
+}
+
+size_t Touch(int value) {
+  return static_cast<size_t>(value);
+}
+
+size_t Touch(const std::string& value) {
+  return value.size();
+}
+
+size_t Touch(const Pod64& value) {
+  return static_cast<size_t>(value.values[0]);
+}
+
+// Keeps compiler from removing computation of value. GCC and Clang get an empty asm statement, other compilers a
+// write of its address to a volatile variable.
+#if defined(__GNUC__)
+template <typename T>
+void DoNotOptimize(const T& value) {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+#else
+volatile const void* do_not_optimize_sink;
+
+template <typename T>
+void DoNotOptimize(const T& value) {
+  do_not_optimize_sink = &value;
+}
+#endif
+
+//
+// DIFFERENCES OF CONTAINERS
+//
+
+template <typename Container>
+void Fill(Container& container, size_t size, size_t divisor = 1) {
+  using T = typename Container::value_type;
+  for (size_t i = 0; i < size; ++i) {
+    container.push_back(MakeValue<T>(i / divisor));
+  }
+}
+
+// Inserts value before pos, after that pos points to the inserted value
+template <typename T, typename Allocator>
+void EmplaceAt(List<T, Allocator>& container, typename List<T, Allocator>::iterator& pos, const T& value) {
+  container.emplace(pos, value);
+  --pos;
+}
+
+// emplace of UnrolledList returns nothing and invalidates pos, insert returns iterator to the inserted value
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void EmplaceAt(UnrolledList<T, ChunkCapacity, Allocator>& container,
+               typename UnrolledList<T, ChunkCapacity, Allocator>::iterator& pos,
+               const T& value) {
+  pos = container.insert(pos, value);
+}
+
+template <typename Container>
+void EmplaceAt(Container& container, typename Container::iterator& pos, const typename Container::value_type& value) {
+  pos = container.emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+void Reverse(List<T, Allocator>& container) {
+  container.reverse();
+}
+
+template <typename T, typename Allocator>
+void Reverse(std::list<T, Allocator>& container) {
+  container.reverse();
+}
+
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void Reverse(UnrolledList<T, ChunkCapacity, Allocator>& container) {
+  container.reverse();
+}
+
+template <typename T, typename Allocator>
+void Reverse(std::deque<T, Allocator>& container) {
+  std::reverse(container.begin(), container.end());
+}
+
+template <typename T, typename Allocator>
+void Unique(List<T, Allocator>& container) {
+  container.unique();
+}
+
+template <typename T, typename Allocator>
+void Unique(std::list<T, Allocator>& container) {
+  container.unique();
+}
+
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void Unique(UnrolledList<T, ChunkCapacity, Allocator>& container) {
+  container.unique();
+}
+
+template <typename T, typename Allocator>
+void Unique(std::deque<T, Allocator>& container) {
+  container.erase(std::unique(container.begin(), container.end()), container.end());
+}
+
+//
+// MEMORY
+//
+
+// Number of bytes currently allocated by all ByteCountingAllocators
+inline size_t allocated_bytes = 0;
+
+// std::allocator, which counts allocated bytes, to measure the memory a container takes for its elements
+template <typename T>
+struct ByteCountingAllocator {
+  using value_type = T;
+
+  ByteCountingAllocator() = default;
+  template <typename U>
+  ByteCountingAllocator(const ByteCountingAllocator<U>&) noexcept {}
+
+  T* allocate(size_t count) {
+    allocated_bytes += count * sizeof(T);
+    return std::allocator<T>().allocate(count);
+  }
+
+  void deallocate(T* pointer, size_t count) noexcept {
+    allocated_bytes -= count * sizeof(T);
+    std::allocator<T>().deallocate(pointer, count);
+  }
+
+  template <typename U>
+  bool operator==(const ByteCountingAllocator<U>&) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const ByteCountingAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+/**
+ * Measures the bytes the container allocates through its allocator per element, when size elements are pushed back.
+ * Memory allocated by elements themselves (like the buffer of a long std::string) is not counted.
+ */
+template <typename Container>
+void MeasureMemory(const std::string& container_name,
+                   const std::string& type_name,
+                   size_t size,
+                   std::vector<MemoryResult>& memory_results) {
+  size_t allocated_before = allocated_bytes;
+  Container container;
+  Fill(container, size);
+  memory_results.push_back(MemoryResult{container_name, type_name, size,
+                                        static_cast<double>(allocated_bytes - allocated_before) /
+                                            static_cast<double>(size)});
+  std::cerr << container_name << " " << type_name << " memory " << size << ": "
+            << memory_results.back().bytes_per_element << " bytes" << std::endl;
+}
+
+//
+// MEASURING
+//
+
+/**
+ * Prepares repetitions states by setup, then measures the time of operation applied to all of them. States are
+ * destroyed after measuring.
+ */
+template <typename Container>
+double MeasureNs(size_t repetitions,
+                 const std::function<void(State<Container>&)>& setup,
+                 const std::function<void(State<Container>&)>& operation) {
+  // std::deque does not move its elements, so iterators in states stay valid
+  std::deque<State<Container>> states;
+  for (size_t i = 0; i < repetitions; ++i) {
+    states.emplace_back();
+    setup(states.back());
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  for (auto& state : states) {
+    operation(state);
+    DoNotOptimize(state);
+  }
+  auto finish = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(finish - start).count();
+}
+
+template <typename Container>
+void RunForContainer(const std::string& container_name,
+                     const std::string& type_name,
+                     size_t size,
+                     std::vector<Result>& results) {
+  using T = typename Container::value_type;
+  using Function = std::function<void(State<Container>&)>;
+
+  // small containers are measured many times, so that every measurement takes about the same time
+  constexpr size_t kElementsPerMeasurement = 100000;
+  size_t repetitions = std::max<size_t>(1, kElementsPerMeasurement / size);
+  // insertions and erasures in the middle of std::deque are linear, their number is limited
+  size_t middle_operations = std::min<size_t>(size / 2, 100);
+
+  auto measure = [&](const std::string& operation_name, size_t operations, const Function& setup,
+                     const Function& operation) {
+    double ns = MeasureNs<Container>(repetitions, setup, operation);
+    results.push_back(Result{container_name, type_name, operation_name, size, repetitions, operations,
+                             ns / static_cast<double>(repetitions * operations)});
+    std::cerr << container_name << " " << type_name << " " << operation_name << " " << size << ": "
+              << results.back().ns_per_operation << " ns" << std::endl;
+  };
+
+  Function empty = [](State<Container>&) {};
+  Function filled = [size](State<Container>& state) {
+    Fill(state.container, size);
+  };
+  Function filled_with_middle = [size](State<Container>& state) {
+    Fill(state.container, size);
+    state.first = std::next(state.container.begin(), static_cast<std::ptrdiff_t>(size / 2));
+  };
+
+  measure("push_back", size, empty, [size](State<Container>& state) {
+    for (size_t i = 0; i < size; ++i) {
+      state.container.push_back(MakeValue<T>(i));
+    }
+  });
+  measure("push_front", size, empty, [size](State<Container>& state) {
+    for (size_t i = 0; i < size; ++i) {
+      state.container.push_front(MakeValue<T>(i));
+    }
+  });
+  measure("pop_back", size, filled, [size](State<Container>& state) {
+    for (size_t i = 0; i < size; ++i) {
+      state.container.pop_back();
+    }
+  });
+  measure("pop_front", size, filled, [size](State<Container>& state) {
+    for (size_t i = 0; i < size; ++i) {
+      state.container.pop_front();
+    }
+  });
+  if (middle_operations > 0) {
+    T value = MakeValue<T>(size);
+    measure("emplace_middle", middle_operations, filled_with_middle, [&](State<Container>& state) {
+      for (size_t i = 0; i < middle_operations; ++i) {
+        EmplaceAt(state.container, *state.first, value);
+      }
+    });
+    measure("erase_middle", middle_operations, filled_with_middle, [&](State<Container>& state) {
+      for (size_t i = 0; i < middle_operations; ++i) {
+        state.first = state.container.erase(*state.first);
+      }
+    });
+  }
+  // queue churn: the size stays the same, every step frees one node and allocates another
+  measure("churn", size, filled, [size](State<Container>& state) {
+    for (size_t i = 0; i < size; ++i) {
+      state.container.pop_front();
+      state.container.push_back(MakeValue<T>(i));
+    }
+  });
+  measure("erase_range", std::max<size_t>(1, size / 2), [size](State<Container>& state) {
+    Fill(state.container, size);
+    state.first = std::next(state.container.begin(), static_cast<std::ptrdiff_t>(size / 4));
+    state.last = std::next(*state.first, static_cast<std::ptrdiff_t>(size / 2));
+  }, [](State<Container>& state) {
+    state.container.erase(*state.first, *state.last);
+  });
+  measure("copy_construct", size, filled, [](State<Container>& state) {
+    state.target.emplace(state.container);
+  });
+  measure("copy_assign", size, [size](State<Container>& state) {
+    Fill(state.container, size);
+    state.target.emplace();
+    Fill(*state.target, size, 2);
+  }, [](State<Container>& state) {
+    *state.target = state.container;
+  });
+  // one move takes constant time, so it is repeated to be measurable, each repetition moves the container out and back
+  constexpr size_t kMoves = 1000;
+  measure("move", kMoves, filled, [](State<Container>& state) {
+    for (size_t i = 0; i < kMoves; ++i) {
+      Container moved(std::move(state.container));
+      state.container = std::move(moved);
+    }
+  });
+  measure("clear", size, filled, [](State<Container>& state) {
+    state.container.clear();
+  });
+  measure("reverse", size, filled, [](State<Container>& state) {
+    Reverse(state.container);
+  });
+  measure("unique", size, [size](State<Container>& state) {
+    Fill(state.container, size, 2);
+  }, [](State<Container>& state) {
+    Unique(state.container);
+  });
+  measure("iterate", size, filled, [](State<Container>& state) {
+    size_t sum = 0;
+    for (const auto& value : state.container) {
+      sum += Touch(value);
+    }
+    DoNotOptimize(sum);
+  });
+}
+
+template <typename T>
+void RunForType(const std::string& type_name,
+                const Options& options,
+                std::vector<Result>& results,
+                std::vector<MemoryResult>& memory_results) {
+  for (size_t size : {10, 1000, 100000, 10000000}) {
+    if (size > options.max_size) {
+      break;
+    }
+    RunForContainer<List<T>>("List", type_name, size, results);
+    RunForContainer<List<T, PoolAllocator<T>>>("List<PoolAllocator>", type_name, size, results);
+    RunForContainer<UnrolledList<T>>("UnrolledList", type_name, size, results);
+    RunForContainer<std::list<T>>("std::list", type_name, size, results);
+    RunForContainer<std::deque<T>>("std::deque", type_name, size, results);
+
+    MeasureMemory<List<T, ByteCountingAllocator<T>>>("List", type_name, size, memory_results);
+    MeasureMemory<UnrolledList<T, 16, ByteCountingAllocator<T>>>("UnrolledList", type_name, size, memory_results);
+    MeasureMemory<std::list<T, ByteCountingAllocator<T>>>("std::list", type_name, size, memory_results);
+    MeasureMemory<std::deque<T, ByteCountingAllocator<T>>>("std::deque", type_name, size, memory_results);
+  }
+}
+
+//
+// OUTPUT
+//
+
+void WriteJson(std::ostream& out, const std::vector<Result>& results, const std::vector<MemoryResult>& memory_results) {
+  WriteJsonHeader(out);
+  out << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    out << "    {\"container\": \"" << EscapeJson(result.container) << "\", "
+        << "\"type\": \"" << EscapeJson(result.type) << "\", "
+        << "\"operation\": \"" << result.operation << "\", "
+        << "\"size\": " << result.size << ", "
+        << "\"repetitions\": " << result.repetitions << ", "
+        << "\"operations\": " << result.operations << ", "
+        << "\"ns_per_operation\": " << result.ns_per_operation << "}"
+        << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  out << "  ],\n";
+  out << "  \"memory\": [\n";
+  for (size_t i = 0; i < memory_results.size(); ++i) {
+    const MemoryResult& result = memory_results[i];
+    out << "    {\"container\": \"" << EscapeJson(result.container) << "\", "
+        << "\"type\": \"" << EscapeJson(result.type) << "\", "
+        << "\"size\": " << result.size << ", "
+        << "\"bytes_per_element\": " << result.bytes_per_element << "}"
+        << (i + 1 < memory_results.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n";
+  out << "}" << std::endl;
+}
@@ -0,0 +1,50 @@
+//
+// Helpers shared by the examples: parsing of command line options, checks of tests and the header of JSON results.
+//
+
+// Every example adds this directory to its include path. Options are given as "--name value" pairs, every example
+// describes its own options by a map from name to setter:
+//   ParseOptions(argc, argv, {{"--operations", SizeOption(options.operation_count)},
+//                             {"--output", StringOption(options.output_path)}});
+// An unknown option, an option without value and a value, which is not a number where a number is expected, print an
+// error and exit with code 1.
+
+// Check and CheckThrows report a failed check of a test to std::cerr and count it in check_failures, so that a test
+// runs all its checks and exits with a non-zero code at the end if any failed.
+
+// WriteJsonHeader writes the opening brace and the "compiler" field of JSON results, so that every benchmark reports
+// the compiler the same way; the caller writes the rest of the object.
+
+
+#pragma once
+
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+
+//
+// DECLARATIONS
+//
+
+using OptionSetter = std::function<void(const std::string& value)>;
+
+void ParseOptions(int argc, char** argv, const std::map<std::string, OptionSetter>& setters);
+
+OptionSetter SizeOption(size_t& target);
+OptionSetter Uint64Option(uint64_t& target);
+OptionSetter StringOption(std::string& target);
+
+inline size_t check_failures = 0;
+
+void Check(bool condition, const std::string& description);
+template <typename Exception>
+void CheckThrows(const std::function<void()>& action, const std::string& description);
+
+std::string CompilerVersion();
+std::string EscapeJson(const std::string& text);
+void WriteJsonHeader(std::ostream& out);
+
+#include "harness.ipp"
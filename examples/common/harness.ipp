@@ -0,0 +1,133 @@
+//
+// This is a .ipp file for harness.hpp. For more information check harness.hpp.
+//
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+
+//
+// OPTIONS
+//
+
+/**
+ * Calls the setter of every "--name value" pair in argv. Prints an error and exits with code 1 if a name has no
+ * setter, if the last name has no value, or if a setter throws std::invalid_argument or std::out_of_range.
+ */
+inline void ParseOptions(int argc, char** argv, const std::map<std::string, OptionSetter>& setters) {
+  for (int i = 1; i < argc; i += 2) {
+    std::string name = argv[i];
+    auto setter = setters.find(name);
+    if (setter == setters.end()) {
+      std::cerr << "Unknown option " << name << std::endl;
+      std::exit(1);
+    }
+    if (i + 1 == argc) {
+      std::cerr << "Option " << name << " needs a value" << std::endl;
+      std::exit(1);
+    }
+    try {
+      setter->second(argv[i + 1]);
+    } catch (const std::invalid_argument&) {
+      std::cerr << "Invalid value " << argv[i + 1] << " of option " << name << std::endl;
+      std::exit(1);
+    } catch (const std::out_of_range&) {
+      std::cerr << "Invalid value " << argv[i + 1] << " of option " << name << std::endl;
+      std::exit(1);
+    }
+  }
+}
+
+/**
+ * Returns setter, which parses value as an unsigned number and stores it to target.
+ */
+inline OptionSetter SizeOption(size_t& target) {
+  return [&target](const std::string& value) {
+    target = static_cast<size_t>(std::stoull(value));
+  };
+}
+
+/**
+ * Returns setter, which parses value as an unsigned 64-bit number and stores it to target.
+ */
+inline OptionSetter Uint64Option(uint64_t& target) {
+  return [&target](const std::string& value) {
+    target = static_cast<uint64_t>(std::stoull(value));
+  };
+}
+
+/**
+ * Returns setter, which stores value to target.
+ */
+inline OptionSetter StringOption(std::string& target) {
+  return [&target](const std::string& value) {
+    target = value;
+  };
+}
+
+//
+// CHECKS
+//
+
+/**
+ * Counts a failure and prints description if condition is false.
+ */
+inline void Check(bool condition, const std::string& description) {
+  if (!condition) {
+    ++check_failures;
+    std::cerr << "FAILED: " << description << std::endl;
+  }
+}
+
+/**
+ * Checks that action throws an exception of type Exception.
+ */
+template <typename Exception>
+void CheckThrows(const std::function<void()>& action, const std::string& description) {
+  try {
+    action();
+  } catch (const Exception&) {
+    return;
+  } catch (const std::exception& exception) {
+    Check(false, description + ": unexpected exception " + exception.what());
+    return;
+  }
+  Check(false, description + ": no exception");
+}
+
+//
+// JSON
+//
+
+/**
+ * Returns version of compiler. It is known for GCC and Clang only, other compilers get "unknown".
+ */
+inline std::string CompilerVersion() {
+#if defined(__GNUC__)
+  return __VERSION__;
+#else
+  return "unknown";
+#endif
+}
+
+/**
+ * Returns text with quotes and backslashes escaped, so that it can be written as a JSON string.
+ */
+inline std::string EscapeJson(const std::string& text) {
+  std::string escaped;
+  for (char symbol : text) {
+    if (symbol == '"' || symbol == '\\') {
+      escaped += '\\';
+    }
+    escaped += symbol;
+  }
+  return escaped;
+}
+
+/**
+ * Writes the opening brace of JSON results and the "compiler" field, followed by a comma.
+ */
+inline void WriteJsonHeader(std::ostream& out) {
+  out << "{\n";
+  out << "  \"compiler\": \"" << EscapeJson(CompilerVersion()) << "\",\n";
+}
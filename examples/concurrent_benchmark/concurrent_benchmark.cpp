@@ -0,0 +1,199 @@
+#include "../../concurrent_queue.hpp"
+#include "../../list.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Result {
+  std::string queue;
+  std::string consumer;
+  size_t producers;
+  size_t values;
+  double mops;
+};
+
+struct Options {
+  size_t max_producer_count = std::max<size_t>(1, std::thread::hardware_concurrency());
+  size_t values_per_producer = 1000000;
+  std::string output_path;
+};
+
+Options ParseOptions(int argc, char** argv);
+void WriteJson(std::ostream& out, const std::vector<Result>& results);
+
+//
+// QUEUES
+//
+
+// The usual alternative: List guarded by a mutex, the consumer takes all values at once by splice
+class MutexListQueue {
+ public:
+  void push_back(uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    values_.push_back(value);
+  }
+
+  bool try_pop_front(uint64_t& value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (values_.empty()) {
+      return false;
+    }
+    value = values_.front();
+    values_.pop_front();
+    return true;
+  }
+
+  template <typename Function>
+  size_t drain(Function function) {
+    List<uint64_t> taken;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      taken.splice(taken.end(), values_);
+    }
+    for (uint64_t value : taken) {
+      function(std::move(value));
+    }
+    return taken.size();
+  }
+
+ private:
+  std::mutex mutex_;
+  List<uint64_t> values_;
+};
+
+//
+// MEASURING
+//
+
+enum class ConsumeMode {
+  kTryPopFront,
+  kDrain,
+};
+
+/**
+ * Starts producer_count producers pushing values_per_producer values each, consumes all of them in this thread and
+ * returns result with the number of millions of values passed through the queue per second.
+ */
+template <typename Queue>
+Result Measure(const std::string& queue_name, ConsumeMode mode, size_t producer_count, size_t values_per_producer) {
+  Queue queue;
+  std::atomic<size_t> ready_count = 0;
+  std::atomic<bool> start = false;
+
+  std::vector<std::thread> producers;
+  for (size_t producer = 0; producer < producer_count; ++producer) {
+    producers.emplace_back([&, producer] {
+      ready_count.fetch_add(1);
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      uint64_t first = static_cast<uint64_t>(producer) * values_per_producer;
+      for (uint64_t value = first; value < first + values_per_producer; ++value) {
+        queue.push_back(value);
+      }
+    });
+  }
+  while (ready_count.load() != producer_count) {
+    std::this_thread::yield();
+  }
+
+  size_t total = producer_count * values_per_producer;
+  size_t received = 0;
+  uint64_t sum = 0;
+  auto begin = std::chrono::steady_clock::now();
+  start.store(true, std::memory_order_release);
+  if (mode == ConsumeMode::kDrain) {
+    while (received < total) {
+      received += queue.drain([&sum](uint64_t&& value) { sum += value; });
+    }
+  } else {
+    uint64_t value = 0;
+    while (received < total) {
+      if (queue.try_pop_front(value)) {
+        sum += value;
+        ++received;
+      }
+    }
+  }
+  auto finish = std::chrono::steady_clock::now();
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+  if (sum != total * (total - 1) / 2) {
+    std::cerr << queue_name << ": wrong sum of received values" << std::endl;
+    std::exit(1);
+  }
+
+  double seconds = std::chrono::duration<double>(finish - begin).count();
+  Result result{queue_name, mode == ConsumeMode::kDrain ? "drain" : "try_pop_front", producer_count, total,
+                static_cast<double>(total) / seconds / 1e6};
+  std::cerr << result.queue << " " << result.consumer << " producers=" << producer_count << ": " << result.mops
+            << " Mops" << std::endl;
+  return result;
+}
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+  size_t values = options.values_per_producer;
+
+  std::vector<Result> results;
+  results.push_back(Measure<SpscQueue<uint64_t>>("SpscQueue", ConsumeMode::kTryPopFront, 1, values));
+  results.push_back(Measure<SpscQueue<uint64_t>>("SpscQueue", ConsumeMode::kDrain, 1, values));
+  // producer counts are powers of two up to the maximal one, which is measured too
+  for (size_t producers = 1; producers <= options.max_producer_count;
+       producers = producers == options.max_producer_count ? producers + 1
+                                                           : std::min(producers * 2, options.max_producer_count)) {
+    for (ConsumeMode mode : {ConsumeMode::kTryPopFront, ConsumeMode::kDrain}) {
+      results.push_back(Measure<MpscQueue<uint64_t>>("MpscQueue", mode, producers, values));
+      results.push_back(Measure<MutexListQueue>("mutex+List", mode, producers, values));
+    }
+  }
+
+  if (options.output_path.empty()) {
+    WriteJson(std::cout, results);
+  } else {
+    std::ofstream out(options.output_path);
+    WriteJson(out, results);
+  }
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--max-producers", SizeOption(options.max_producer_count)},
+                            {"--values", SizeOption(options.values_per_producer)},
+                            {"--output", StringOption(options.output_path)}});
+  return options;
+}
+
+//
+// OUTPUT
+//
+
+void WriteJson(std::ostream& out, const std::vector<Result>& results) {
+  WriteJsonHeader(out);
+  out << "  \"hardware_concurrency\": " << std::thread::hardware_concurrency() << ",\n";
+  out << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    out << "    {\"queue\": \"" << result.queue << "\", "
+        << "\"consumer\": \"" << result.consumer << "\", "
+        << "\"producers\": " << result.producers << ", "
+        << "\"values\": " << result.values << ", "
+        << "\"mops\": " << result.mops << "}"
+        << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n";
+  out << "}" << std::endl;
+}
@@ -0,0 +1,211 @@
+#include "../../concurrent_queue.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Value pushed by producers. payload is long enough not to fit in the small string buffer, so that every value owns
+// heap memory and lost or doubly destroyed values are seen by sanitizers.
+struct Message {
+  uint32_t producer;
+  uint32_t sequence;
+  std::string payload;
+};
+
+enum class ConsumeMode {
+  kTryPopFront,
+  kDrain,
+  kMixed,
+};
+
+struct Options {
+  size_t producer_count = std::max<size_t>(2, std::thread::hardware_concurrency());
+  size_t values_per_producer = 200000;
+};
+
+Options ParseOptions(int argc, char** argv);
+
+//
+// CHECKING
+//
+
+std::string MakePayload(uint32_t producer, uint32_t sequence) {
+  return "payload of producer " + std::to_string(producer) + " number " + std::to_string(sequence);
+}
+
+// Checks order and number of values received by the consumer
+class Checker {
+ public:
+  Checker(const std::string& name, size_t producer_count)
+      : name_(name), next_sequence_(producer_count, 0) {}
+
+  void Receive(const Message& message) {
+    ++received_;
+    if (message.producer >= next_sequence_.size()) {
+      Fail("value of unknown producer " + std::to_string(message.producer));
+      return;
+    }
+    uint32_t& expected = next_sequence_[message.producer];
+    if (message.sequence != expected) {
+      Fail("producer " + std::to_string(message.producer) + ": expected value " + std::to_string(expected) +
+           ", received " + std::to_string(message.sequence));
+    }
+    if (message.payload != MakePayload(message.producer, message.sequence)) {
+      Fail("producer " + std::to_string(message.producer) + ": corrupted payload of value " +
+           std::to_string(message.sequence));
+    }
+    expected = message.sequence + 1;
+  }
+
+  size_t Received() const {
+    return received_;
+  }
+
+  void CheckAllReceived(size_t values_per_producer) {
+    for (size_t producer = 0; producer < next_sequence_.size(); ++producer) {
+      if (next_sequence_[producer] != values_per_producer) {
+        Fail("producer " + std::to_string(producer) + ": received " + std::to_string(next_sequence_[producer]) +
+             " of " + std::to_string(values_per_producer) + " values");
+      }
+    }
+  }
+
+  void Fail(const std::string& message) {
+    // the first failures are enough, after one lost value every next one is reported too
+    if (failures_++ < 10) {
+      std::cerr << name_ << ": " << message << std::endl;
+    }
+  }
+
+  bool Passed() const {
+    return failures_ == 0;
+  }
+
+ private:
+  std::string name_;
+  std::vector<uint32_t> next_sequence_;
+  size_t received_ = 0;
+  size_t failures_ = 0;
+};
+
+//
+// RUNNING
+//
+
+/**
+ * Starts producer_count producers pushing values_per_producer values each into one queue, consumes them in this
+ * thread in the given mode and checks that every producer's values arrive exactly once and in the order they were
+ * pushed. Returns true if the check passed.
+ */
+template <typename Queue>
+bool Run(const std::string& name, ConsumeMode mode, size_t producer_count, size_t values_per_producer) {
+  Queue queue;
+  Checker checker(name, producer_count);
+  std::atomic<bool> start = false;
+
+  std::vector<std::thread> producers;
+  for (size_t producer = 0; producer < producer_count; ++producer) {
+    producers.emplace_back([&, producer] {
+      while (!start.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      for (size_t sequence = 0; sequence < values_per_producer; ++sequence) {
+        auto id = static_cast<uint32_t>(producer);
+        auto number = static_cast<uint32_t>(sequence);
+        if (sequence % 2 == 0) {
+          queue.push_back(Message{id, number, MakePayload(id, number)});
+        } else {
+          queue.emplace_back(Message{id, number, MakePayload(id, number)});
+        }
+      }
+    });
+  }
+
+  start.store(true, std::memory_order_release);
+  size_t total = producer_count * values_per_producer;
+  size_t round = 0;
+  Message message;
+  while (checker.Received() < total) {
+    bool use_drain = mode == ConsumeMode::kDrain || (mode == ConsumeMode::kMixed && round++ % 2 == 1);
+    if (use_drain) {
+      queue.drain([&checker](Message&& drained) { checker.Receive(drained); });
+    } else if (queue.try_pop_front(message)) {
+      checker.Receive(message);
+    }
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  if (!queue.empty() || queue.try_pop_front(message) ||
+      queue.drain([&checker](Message&& drained) { checker.Receive(drained); }) != 0) {
+    checker.Fail("queue is not empty after all values were received");
+  }
+  checker.CheckAllReceived(values_per_producer);
+
+  std::cerr << name << ": " << (checker.Passed() ? "passed" : "FAILED") << std::endl;
+  return checker.Passed();
+}
+
+/**
+ * Pushes values from several producers and destroys the queue without consuming them, so that sanitizers check that
+ * the destructor frees every value.
+ */
+template <typename Queue>
+bool RunDestroyNonEmpty(const std::string& name, size_t producer_count, size_t values_per_producer) {
+  {
+    Queue queue;
+    std::vector<std::thread> producers;
+    for (size_t producer = 0; producer < producer_count; ++producer) {
+      producers.emplace_back([&, producer] {
+        for (size_t sequence = 0; sequence < values_per_producer; ++sequence) {
+          auto id = static_cast<uint32_t>(producer);
+          auto number = static_cast<uint32_t>(sequence);
+          queue.push_back(Message{id, number, MakePayload(id, number)});
+        }
+      });
+    }
+    for (auto& producer : producers) {
+      producer.join();
+    }
+
+    // a part of values is consumed, the rest is left to the destructor
+    Message message;
+    for (size_t i = 0; i < values_per_producer / 2; ++i) {
+      queue.try_pop_front(message);
+    }
+  }
+  std::cerr << name << ": passed" << std::endl;
+  return true;
+}
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+  size_t producers = options.producer_count;
+  size_t values = options.values_per_producer;
+
+  bool passed = true;
+  passed &= Run<MpscQueue<Message>>("mpsc try_pop_front", ConsumeMode::kTryPopFront, producers, values);
+  passed &= Run<MpscQueue<Message>>("mpsc drain", ConsumeMode::kDrain, producers, values);
+  passed &= Run<MpscQueue<Message>>("mpsc mixed", ConsumeMode::kMixed, producers, values);
+  passed &= Run<SpscQueue<Message>>("spsc try_pop_front", ConsumeMode::kTryPopFront, 1, values);
+  passed &= Run<SpscQueue<Message>>("spsc drain", ConsumeMode::kDrain, 1, values);
+  passed &= Run<SpscQueue<Message>>("spsc mixed", ConsumeMode::kMixed, 1, values);
+  passed &= RunDestroyNonEmpty<MpscQueue<Message>>("mpsc destroy non-empty", producers, values);
+
+  return passed ? 0 : 1;
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--producers", SizeOption(options.producer_count)},
+                            {"--values", SizeOption(options.values_per_producer)}});
+  return options;
+}
@@ -0,0 +1,357 @@
+#include "../../intrusive_list.hpp"
+
+#include "harness.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct Options {
+  size_t operation_count = 200000;
+  uint64_t seed = 42;
+};
+
+Options ParseOptions(int argc, char** argv);
+
+//
+// OBJECTS
+//
+
+// Every task may be in one of two lists by all_hook and at the same time in the ready list by ready_hook. The hooks
+// are not the first members, so that the offset of hook in the object is not zero.
+struct Task {
+  int id;
+  IntrusiveListHook all_hook;
+  std::string name;
+  IntrusiveListHook ready_hook;
+};
+
+using AllList = IntrusiveList<Task, INTRUSIVE_LIST_MEMBER(Task, all_hook)>;
+using ReadyList = IntrusiveList<Task, INTRUSIVE_LIST_MEMBER(Task, ready_hook)>;
+using Model = std::list<int>;
+
+constexpr size_t kTaskCount = 64;
+
+//
+// CHECKING
+//
+
+template <typename Container>
+typename Container::iterator IteratorAt(Container& container, size_t index) {
+  return std::next(container.begin(), static_cast<std::ptrdiff_t>(index));
+}
+
+/**
+ * Returns true if list contains the tasks of model in the same order, both forwards and backwards, CheckStatus holds
+ * and every task is the one with its id.
+ */
+template <typename IntrusiveListType>
+bool Equal(const IntrusiveListType& list, const Model& model, const std::vector<Task>& tasks) {
+  list.CheckStatus();
+  if (list.size() != model.size() || list.empty() != model.empty()) {
+    return false;
+  }
+  auto model_it = model.begin();
+  for (const Task& task : list) {
+    if (&task != &tasks[static_cast<size_t>(*model_it)] || task.name != "task " + std::to_string(task.id)) {
+      return false;
+    }
+    ++model_it;
+  }
+  auto model_reverse_it = model.rbegin();
+  for (auto it = list.rbegin(); it != list.rend(); ++it, ++model_reverse_it) {
+    if (it->id != *model_reverse_it) {
+      return false;
+    }
+  }
+  return model.empty() || (list.front().id == model.front() && list.back().id == model.back());
+}
+
+/**
+ * Returns true if exactly the tasks of models are linked by hook.
+ */
+bool LinkedAsModels(const std::vector<Task>& tasks, IntrusiveListHook Task::*hook, std::vector<const Model*> models) {
+  std::vector<bool> in_model(tasks.size(), false);
+  for (const Model* model : models) {
+    for (int id : *model) {
+      in_model[static_cast<size_t>(id)] = true;
+    }
+  }
+  for (const Task& task : tasks) {
+    if ((task.*hook).is_linked() != in_model[static_cast<size_t>(task.id)]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//
+// RUNNING
+//
+
+/**
+ * Applies operation_count random operations to two lists of tasks by all_hook and one list by ready_hook, the same
+ * operations to std::lists of ids, and compares them after every operation. Tasks of the ready list are in one of the
+ * other lists too, so that erasing and splicing by one hook is checked not to touch the other one. Returns true if all
+ * checks passed.
+ */
+bool Run(const Options& options) {
+  std::mt19937_64 generator(options.seed);
+  std::vector<Task> tasks(kTaskCount);
+  for (size_t i = 0; i < kTaskCount; ++i) {
+    tasks[i].id = static_cast<int>(i);
+    tasks[i].name = "task " + std::to_string(i);
+  }
+
+  AllList lists[2];
+  ReadyList ready;
+  Model models[2];
+  Model ready_model;
+
+  auto random = [&generator](size_t bound) {
+    return static_cast<size_t>(generator() % bound);
+  };
+  // returns id of a random task, which is not linked by hook, or -1 if all are linked
+  auto random_unlinked = [&](IntrusiveListHook Task::*hook) {
+    size_t start = random(kTaskCount);
+    for (size_t i = 0; i < kTaskCount; ++i) {
+      Task& task = tasks[(start + i) % kTaskCount];
+      if (!(task.*hook).is_linked()) {
+        return task.id;
+      }
+    }
+    return -1;
+  };
+
+  for (size_t step = 0; step < options.operation_count; ++step) {
+    size_t to = random(2);
+    AllList& list = lists[to];
+    AllList& other = lists[1 - to];
+    Model& model = models[to];
+    Model& other_model = models[1 - to];
+    size_t operation = random(14);
+    const char* name = "";
+
+    if (operation < 3) {
+      int id = random_unlinked(&Task::all_hook);
+      if (id < 0) {
+        continue;
+      }
+      Task& task = tasks[static_cast<size_t>(id)];
+      size_t pos = random(model.size() + 1);
+      if (operation == 0) {
+        name = "push_back";
+        list.push_back(task);
+        model.push_back(id);
+      } else if (operation == 1) {
+        name = "push_front";
+        list.push_front(task);
+        model.push_front(id);
+      } else {
+        name = "insert";
+        auto it = list.insert(IteratorAt(list, pos), task);
+        model.insert(IteratorAt(model, pos), id);
+        if (&*it != &task || it != list.iterator_to(task)) {
+          std::cerr << "insert returned wrong iterator at step " << step << std::endl;
+          return false;
+        }
+      }
+    } else if (operation == 3) {
+      // only tasks, which are in one of the lists, become ready
+      name = "ready insert";
+      if (model.empty()) {
+        continue;
+      }
+      int id = *IteratorAt(model, random(model.size()));
+      if (tasks[static_cast<size_t>(id)].ready_hook.is_linked()) {
+        continue;
+      }
+      size_t pos = random(ready_model.size() + 1);
+      ready.insert(IteratorAt(ready, pos), tasks[static_cast<size_t>(id)]);
+      ready_model.insert(IteratorAt(ready_model, pos), id);
+    } else if (operation == 4 && !ready.empty()) {
+      name = "ready pop";
+      if (random(2) == 0) {
+        ready.pop_front();
+        ready_model.pop_front();
+      } else {
+        ready.pop_back();
+        ready_model.pop_back();
+      }
+    } else if (operation == 5 && !model.empty()) {
+      name = "erase object";
+      auto model_it = IteratorAt(model, random(model.size()));
+      Task& task = tasks[static_cast<size_t>(*model_it)];
+      // a task leaves the ready list first, as when it is finished
+      if (task.ready_hook.is_linked()) {
+        ready.erase(task);
+        ready_model.remove(task.id);
+      }
+      auto next = list.erase(task);
+      auto model_next = model.erase(model_it);
+      if (std::distance(list.begin(), next) != std::distance(model.begin(), model_next)) {
+        std::cerr << "erase returned wrong iterator at step " << step << std::endl;
+        return false;
+      }
+    } else if (operation == 6 && !model.empty()) {
+      name = "erase iterator";
+      size_t pos = random(model.size());
+      Task& task = *IteratorAt(list, pos);
+      if (task.ready_hook.is_linked()) {
+        ready.erase(ready.iterator_to(task));
+        ready_model.remove(task.id);
+      }
+      list.erase(IteratorAt(list, pos));
+      model.erase(IteratorAt(model, pos));
+    } else if (operation == 7 && !model.empty()) {
+      name = "pop";
+      if (random(2) == 0) {
+        list.pop_front();
+        model.pop_front();
+      } else {
+        list.pop_back();
+        model.pop_back();
+      }
+    } else if (operation == 8) {
+      name = "splice whole";
+      size_t pos = random(model.size() + 1);
+      list.splice(IteratorAt(list, pos), other);
+      model.splice(IteratorAt(model, pos), other_model);
+    } else if (operation == 9 && !other_model.empty()) {
+      name = "splice node";
+      size_t pos = random(model.size() + 1);
+      size_t index = random(other_model.size());
+      list.splice(IteratorAt(list, pos), other, IteratorAt(other, index));
+      model.splice(IteratorAt(model, pos), other_model, IteratorAt(other_model, index));
+    } else if (operation == 10 && !model.empty()) {
+      name = "splice node within list";
+      size_t pos = random(model.size() + 1);
+      size_t index = random(model.size());
+      list.splice(IteratorAt(list, pos), list, IteratorAt(list, index));
+      model.splice(IteratorAt(model, pos), model, IteratorAt(model, index));
+    } else if (operation == 11 && step % 16 == 0) {
+      name = "move";
+      AllList moved(std::move(list));
+      if (!list.empty() || !Equal(moved, model, tasks)) {
+        std::cerr << "move constructor lost tasks at step " << step << std::endl;
+        return false;
+      }
+      // assignment unlinks the own tasks of other, then takes the tasks of moved
+      for (const Task& task : other) {
+        if (task.ready_hook.is_linked()) {
+          ready.erase(tasks[static_cast<size_t>(task.id)]);
+          ready_model.remove(task.id);
+        }
+      }
+      other = std::move(moved);
+      other_model = std::move(model);
+      model.clear();
+    } else if (operation == 12 && step % 64 == 0) {
+      name = "clear";
+      for (const Task& task : list) {
+        if (task.ready_hook.is_linked()) {
+          ready.erase(tasks[static_cast<size_t>(task.id)]);
+          ready_model.remove(task.id);
+        }
+      }
+      list.clear();
+      model.clear();
+    } else if (operation == 13 && step % 64 == 0) {
+      name = "ready clear";
+      ready.clear();
+      ready_model.clear();
+    } else {
+      continue;
+    }
+
+    if (!Equal(lists[0], models[0], tasks) || !Equal(lists[1], models[1], tasks) ||
+        !Equal(ready, ready_model, tasks)) {
+      std::cerr << "lists differ after " << name << " at step " << step << std::endl;
+      return false;
+    }
+    if (!LinkedAsModels(tasks, &Task::all_hook, {&models[0], &models[1]}) ||
+        !LinkedAsModels(tasks, &Task::ready_hook, {&ready_model})) {
+      std::cerr << "hooks are linked not as in lists after " << name << " at step " << step << std::endl;
+      return false;
+    }
+  }
+
+  // tasks are unlinked before they are destroyed, the hooks check it in debug mode
+  ready.clear();
+  lists[0].clear();
+  lists[1].clear();
+  std::cerr << "intrusive list: passed" << std::endl;
+  return true;
+}
+
+// Object with two hooks, the first one at offset zero and the second one after a value
+struct Timer {
+  IntrusiveListHook queue_hook;
+  uint64_t deadline;
+  IntrusiveListHook expired_hook;
+};
+
+using QueueList = IntrusiveList<Timer, INTRUSIVE_LIST_MEMBER(Timer, queue_hook)>;
+using ExpiredList = IntrusiveList<Timer, INTRUSIVE_LIST_MEMBER(Timer, expired_hook)>;
+
+/**
+ * Links the same timers into two lists by hooks at zero and non-zero offsets and checks that both lists find every
+ * timer at its own address, forwards, backwards and through iterator_to. Returns true if all checks passed.
+ */
+bool RunTwoHooks() {
+  static_assert(offsetof(Timer, queue_hook) == 0 && offsetof(Timer, expired_hook) != 0, "Hooks must be at two offsets");
+  std::vector<Timer> timers(8);
+  QueueList queue;
+  ExpiredList expired;
+  for (size_t i = 0; i < timers.size(); ++i) {
+    timers[i].deadline = i;
+    queue.push_back(timers[i]);
+    if (i % 2 == 0) {
+      expired.push_front(timers[i]);
+    }
+  }
+  queue.CheckStatus();
+  expired.CheckStatus();
+
+  size_t index = 0;
+  for (const Timer& timer : queue) {
+    Check(&timer == &timers[index++], "queue finds timers by the hook at offset zero");
+  }
+  index = timers.size();
+  for (auto it = expired.begin(); it != expired.end(); ++it) {
+    index -= 2;
+    Check(&*it == &timers[index], "expired list finds timers by the hook at non-zero offset");
+    Check(&*expired.iterator_to(timers[index]) == &timers[index], "iterator_to finds the timer");
+  }
+  Check(&expired.front() == &timers[6] && &expired.back() == &timers[0] && &queue.back() == &timers[7],
+        "front and back are the linked timers");
+
+  expired.erase(timers[2]);
+  Check(queue.size() == timers.size() && expired.size() == 3, "erase by one hook leaves the other list");
+  queue.clear();
+  expired.clear();
+
+  bool passed = check_failures == 0;
+  std::cerr << (passed ? "two hooks: passed" : "two hooks: FAILED") << std::endl;
+  return passed;
+}
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+  bool passed = RunTwoHooks();
+  passed &= Run(options);
+  return passed ? 0 : 1;
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--operations", SizeOption(options.operation_count)},
+                            {"--seed", Uint64Option(options.seed)}});
+  return options;
+}
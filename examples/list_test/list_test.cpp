@@ -0,0 +1,726 @@
+#include "../../list.hpp"
+#include "../../list_instrumentation.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+struct Options {
+  size_t operation_count = 200000;
+  uint64_t seed = 42;
+};
+
+Options ParseOptions(int argc, char** argv);
+
+//
+// VALUES
+//
+
+// Values are ordered by key only. Keys repeat, so that id shows whether equal values kept their order. payload owns
+// heap memory, so that lost or doubly destroyed values are seen by sanitizers.
+struct Item {
+  int key;
+  int id;
+  std::string payload;
+
+  bool operator<(const Item& other) const {
+    return key < other.key;
+  }
+};
+
+struct ByKey {
+  bool operator()(const Item& left, const Item& right) const {
+    return left.key < right.key;
+  }
+};
+
+// Comparator, which throws on the throw_at-th call
+struct ThrowingByKey {
+  size_t* calls;
+  size_t throw_at;
+
+  bool operator()(const Item& left, const Item& right) const {
+    if (++*calls == throw_at) {
+      throw std::runtime_error("comparator failed");
+    }
+    return left.key < right.key;
+  }
+};
+
+using TestList = List<Item, std::allocator<Item>, CountingInstrumentation>;
+using Model = std::list<Item>;
+
+// Value, which counts its live instances, so that values, which are not destroyed or destroyed twice, are seen.
+// Constructor from a negative number throws, and so does the copy, which uses up copies_left.
+struct Tracked {
+  static size_t live;
+  static size_t copies_left;
+
+  int value;
+
+  explicit Tracked(int value) : value(value) {
+    if (value < 0) {
+      throw std::runtime_error("negative value");
+    }
+    ++live;
+  }
+  Tracked(const Tracked& other) : value(other.value) {
+    UseCopy();
+    ++live;
+  }
+  Tracked(Tracked&& other) noexcept : value(other.value) {
+    ++live;
+  }
+  Tracked& operator=(const Tracked& other) {
+    UseCopy();
+    value = other.value;
+    return *this;
+  }
+  Tracked& operator=(Tracked&& other) noexcept = default;
+  ~Tracked() {
+    --live;
+  }
+
+  static void UseCopy() {
+    if (copies_left == 0) {
+      throw std::runtime_error("copy failed");
+    }
+    --copies_left;
+  }
+};
+
+size_t Tracked::live = 0;
+size_t Tracked::copies_left = SIZE_MAX;
+
+bool operator==(const Tracked& lhs, const Tracked& rhs) {
+  return lhs.value == rhs.value;
+}
+
+// Allocator, which counts calls and bytes of all its copies and rebound copies
+struct AllocatorCounters {
+  size_t allocations = 0;
+  size_t deallocations = 0;
+  size_t allocated_bytes = 0;
+  size_t deallocated_bytes = 0;
+};
+
+AllocatorCounters allocator_counters;
+
+template <typename T>
+struct TrackingAllocator {
+  using value_type = T;
+
+  TrackingAllocator() = default;
+  template <typename U>
+  TrackingAllocator(const TrackingAllocator<U>&) noexcept {}
+
+  T* allocate(size_t count) {
+    ++allocator_counters.allocations;
+    allocator_counters.allocated_bytes += count * sizeof(T);
+    return std::allocator<T>().allocate(count);
+  }
+  void deallocate(T* pointer, size_t count) noexcept {
+    ++allocator_counters.deallocations;
+    allocator_counters.deallocated_bytes += count * sizeof(T);
+    std::allocator<T>().deallocate(pointer, count);
+  }
+
+  template <typename U>
+  bool operator==(const TrackingAllocator<U>&) const noexcept {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const TrackingAllocator<U>&) const noexcept {
+    return false;
+  }
+};
+
+using CountedList = List<Tracked, TrackingAllocator<Tracked>, CountingInstrumentation>;
+
+//
+// CHECKING
+//
+
+template <typename Container>
+typename Container::iterator IteratorAt(Container& container, size_t index) {
+  return std::next(container.begin(), static_cast<std::ptrdiff_t>(index));
+}
+
+/**
+ * Returns true if links of list are consistent with its size: CheckStatus holds, walks forwards and backwards visit
+ * size() nodes, and the live nodes counted by instrumentation are the same number.
+ */
+bool Consistent(TestList& list) {
+  list.CheckStatus();
+  size_t forward = 0;
+  for (auto it = list.begin(); it != list.end(); ++it) {
+    ++forward;
+  }
+  size_t backward = 0;
+  for (auto it = list.rbegin(); it != list.rend(); ++it) {
+    ++backward;
+  }
+  return forward == list.size() && backward == list.size() && list.GetStats().live_nodes == list.size() &&
+         list.empty() == (list.size() == 0);
+}
+
+/**
+ * Returns true if list is consistent and contains the same values in the same order as model.
+ */
+bool Equal(TestList& list, const Model& model) {
+  if (!Consistent(list) || list.size() != model.size()) {
+    return false;
+  }
+  auto model_it = model.begin();
+  for (const Item& item : list) {
+    if (item.key != model_it->key || item.id != model_it->id || item.payload != model_it->payload) {
+      return false;
+    }
+    ++model_it;
+  }
+  return true;
+}
+
+std::vector<int> SortedIds(const TestList& first, const TestList& second) {
+  std::vector<int> ids;
+  for (const Item& item : first) {
+    ids.push_back(item.id);
+  }
+  for (const Item& item : second) {
+    ids.push_back(item.id);
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+Model ToModel(const TestList& list) {
+  return Model(list.begin(), list.end());
+}
+
+//
+// RUNNING
+//
+
+/**
+ * Applies operation_count random splice, merge and sort operations to two Lists and the same ones to two std::lists,
+ * and compares them after every operation. Sorts and merges sometimes get a comparator, which throws in the middle:
+ * then both lists must stay consistent and keep all values between them. Returns true if all checks passed.
+ */
+bool Run(const Options& options) {
+  std::mt19937_64 generator(options.seed);
+  TestList lists[2];
+  Model models[2];
+  int next_id = 0;
+  size_t throws = 0;
+
+  auto random = [&generator](size_t bound) {
+    return static_cast<size_t>(generator() % bound);
+  };
+  auto make_item = [&] {
+    int id = next_id++;
+    int key = static_cast<int>(random(10));
+    return Item{key, id, "payload that does not fit in the small buffer " + std::to_string(id)};
+  };
+
+  for (size_t step = 0; step < options.operation_count; ++step) {
+    // operations take values from "other" to "list", the lists swap roles randomly
+    size_t to = random(2);
+    TestList& list = lists[to];
+    TestList& other = lists[1 - to];
+    Model& model = models[to];
+    Model& other_model = models[1 - to];
+    size_t operation = random(12);
+    const char* name = "";
+
+    if (operation < 2 || other.size() < 2) {
+      name = "push";
+      for (size_t count = random(8); count > 0; --count) {
+        Item item = make_item();
+        other_model.push_back(item);
+        other.push_back(std::move(item));
+      }
+    } else if (operation == 2 && list.size() > 64) {
+      name = "pop";
+      while (list.size() > 32) {
+        list.pop_front();
+        model.pop_front();
+      }
+    } else if (operation == 3) {
+      name = "splice whole";
+      size_t pos = random(list.size() + 1);
+      if (random(2) == 0) {
+        list.splice(IteratorAt(list, pos), other);
+      } else {
+        list.splice(IteratorAt(list, pos), std::move(other));
+      }
+      model.splice(IteratorAt(model, pos), other_model);
+    } else if (operation == 4) {
+      name = "splice node";
+      size_t pos = random(list.size() + 1);
+      size_t index = random(other.size());
+      list.splice(IteratorAt(list, pos), other, IteratorAt(other, index));
+      model.splice(IteratorAt(model, pos), other_model, IteratorAt(other_model, index));
+    } else if (operation == 5 && !list.empty()) {
+      name = "splice node within list";
+      size_t pos = random(list.size() + 1);
+      size_t index = random(list.size());
+      list.splice(IteratorAt(list, pos), list, IteratorAt(list, index));
+      model.splice(IteratorAt(model, pos), model, IteratorAt(model, index));
+    } else if (operation == 6) {
+      name = "splice range";
+      size_t pos = random(list.size() + 1);
+      size_t first = random(other.size() + 1);
+      size_t last = first + random(other.size() - first + 1);
+      list.splice(IteratorAt(list, pos), other, IteratorAt(other, first), IteratorAt(other, last));
+      model.splice(IteratorAt(model, pos), other_model, IteratorAt(other_model, first), IteratorAt(other_model, last));
+    } else if (operation == 7 && !list.empty()) {
+      name = "splice range within list";
+      size_t first = random(list.size() + 1);
+      size_t last = first + random(list.size() - first + 1);
+      // pos must not be inside [first, last)
+      size_t outside = random(list.size() - (last - first) + 1);
+      size_t pos = outside < first ? outside : outside + (last - first);
+      list.splice(IteratorAt(list, pos), list, IteratorAt(list, first), IteratorAt(list, last));
+      model.splice(IteratorAt(model, pos), model, IteratorAt(model, first), IteratorAt(model, last));
+    } else if (operation == 8) {
+      name = "sort";
+      if (random(2) == 0) {
+        list.sort();
+      } else {
+        list.sort(ByKey());
+      }
+      model.sort(ByKey());
+    } else if (operation == 9) {
+      name = "merge";
+      list.sort(ByKey());
+      other.sort(ByKey());
+      model.sort(ByKey());
+      other_model.sort(ByKey());
+      if (random(2) == 0) {
+        list.merge(other);
+      } else {
+        list.merge(std::move(other), ByKey());
+      }
+      model.merge(other_model, ByKey());
+    } else if (operation >= 10) {
+      // comparator throws at a random call, or not at all if the operation needs fewer calls
+      std::vector<int> ids_before = SortedIds(list, other);
+      size_t calls = 0;
+      ThrowingByKey comparator{&calls, 1 + random(4 * (list.size() + other.size()) + 1)};
+      try {
+        if (operation == 10) {
+          name = "sort with throwing comparator";
+          list.sort(comparator);
+        } else {
+          name = "merge with throwing comparator";
+          list.sort(ByKey());
+          other.sort(ByKey());
+          list.merge(other, comparator);
+        }
+      } catch (const std::runtime_error&) {
+        ++throws;
+      }
+      if (!Consistent(list) || !Consistent(other) || SortedIds(list, other) != ids_before) {
+        std::cerr << name << ": lists are broken or lost values at step " << step << std::endl;
+        return false;
+      }
+      // the order after an exception is unspecified, models take it from lists
+      model = ToModel(list);
+      other_model = ToModel(other);
+    } else {
+      continue;
+    }
+
+    if (!Equal(list, model) || !Equal(other, other_model)) {
+      std::cerr << "lists differ after " << name << " at step " << step << std::endl;
+      return false;
+    }
+  }
+
+  if (throws == 0) {
+    std::cerr << "comparator never threw, exception paths were not checked" << std::endl;
+    return false;
+  }
+  std::cerr << "splice, merge and sort: passed, " << throws << " comparator exceptions" << std::endl;
+  return true;
+}
+
+/**
+ * Applies operation_count random constructions, assignments, insertions and resizes to List and the same ones to
+ * std::list, and compares them after every operation. Insertions are done at the beginning, in the middle and at the
+ * end, assignments and resizes both grow and shrink the list, copy assignments get lists of the same size, so that
+ * all nodes are reused. Returns true if all checks passed.
+ */
+bool RunFilling(const Options& options) {
+  std::mt19937_64 generator(options.seed + 1);
+  TestList list;
+  Model model;
+  int next_id = 0;
+
+  auto random = [&generator](size_t bound) {
+    return static_cast<size_t>(generator() % bound);
+  };
+  auto make_item = [&] {
+    int id = next_id++;
+    int key = static_cast<int>(random(10));
+    return Item{key, id, "payload that does not fit in the small buffer " + std::to_string(id)};
+  };
+  auto make_items = [&] {
+    std::vector<Item> items(random(3) == 0 ? 0 : random(16));
+    for (Item& item : items) {
+      item = make_item();
+    }
+    return items;
+  };
+  // new sizes are mostly around the current one, so that lists both grow and shrink
+  auto new_size = [&] {
+    return random(4) == 0 ? random(40) : model.size() + random(9) - std::min<size_t>(model.size(), 4);
+  };
+  // insertions happen at the beginning, at the end or in the middle
+  auto position = [&] {
+    size_t where = random(3);
+    return where == 0 ? 0 : where == 1 ? model.size() : random(model.size() + 1);
+  };
+
+  for (size_t step = 0; step < options.operation_count; ++step) {
+    size_t operation = random(13);
+    const char* name = "";
+
+    if (operation == 0) {
+      name = "range constructor";
+      std::vector<Item> items = make_items();
+      list = TestList(items.begin(), items.end());
+      model = Model(items.begin(), items.end());
+    } else if (operation == 1) {
+      name = "initializer list constructor";
+      Item first = make_item();
+      Item second = make_item();
+      list = TestList({first, second});
+      model = Model({first, second});
+    } else if (operation == 2) {
+      name = "assign range";
+      std::vector<Item> items = make_items();
+      if (random(2) == 0) {
+        list.assign(items.begin(), items.end());
+      } else {
+        std::vector<Item> moved = items;
+        list.assign(std::make_move_iterator(moved.begin()), std::make_move_iterator(moved.end()));
+      }
+      model.assign(items.begin(), items.end());
+    } else if (operation == 3) {
+      name = "assign count";
+      size_t count = new_size();
+      Item item = make_item();
+      list.assign(count, item);
+      model.assign(count, item);
+    } else if (operation == 4) {
+      name = "assign initializer list";
+      Item item = make_item();
+      list.assign({item, item, item});
+      model.assign({item, item, item});
+    } else if (operation == 5) {
+      name = "assign operator with initializer list";
+      Item first = make_item();
+      Item second = make_item();
+      if (random(2) == 0) {
+        list = {first, second};
+        model = {first, second};
+      } else {
+        list = {};
+        model = {};
+      }
+    } else if (operation >= 6 && operation <= 8) {
+      size_t pos = position();
+      // distances from begin to the iterators returned by list and model
+      std::ptrdiff_t returned = 0;
+      std::ptrdiff_t model_returned = 0;
+      if (operation == 6) {
+        name = "insert count";
+        size_t count = random(5);
+        Item item = make_item();
+        returned = std::distance(list.begin(), list.insert(IteratorAt(list, pos), count, item));
+        model_returned = std::distance(model.begin(), model.insert(IteratorAt(model, pos), count, item));
+      } else if (operation == 7) {
+        name = "insert range";
+        std::vector<Item> items = make_items();
+        returned = std::distance(list.begin(), list.insert(IteratorAt(list, pos), items.begin(), items.end()));
+        model_returned = std::distance(model.begin(), model.insert(IteratorAt(model, pos), items.begin(), items.end()));
+      } else {
+        name = "insert initializer list";
+        Item first = make_item();
+        Item second = make_item();
+        returned = std::distance(list.begin(), list.insert(IteratorAt(list, pos), {first, second}));
+        model_returned = std::distance(model.begin(), model.insert(IteratorAt(model, pos), {first, second}));
+      }
+      if (returned != model_returned) {
+        std::cerr << name << " returned wrong iterator at step " << step << std::endl;
+        return false;
+      }
+    } else if (operation == 9) {
+      name = "resize";
+      size_t count = new_size();
+      list.resize(count);
+      model.resize(count);
+    } else if (operation == 10) {
+      name = "resize with value";
+      size_t count = new_size();
+      Item item = make_item();
+      list.resize(count, item);
+      model.resize(count, item);
+    } else if (operation == 11) {
+      name = "copy assignment";
+      // source of the same size reuses every node, other sizes reuse some of them
+      std::vector<Item> items(random(2) == 0 ? model.size() : new_size());
+      for (Item& item : items) {
+        item = make_item();
+      }
+      TestList other(items.begin(), items.end());
+      list = other;
+      model = Model(items.begin(), items.end());
+      if (!Equal(other, model)) {
+        std::cerr << "source of copy assignment changed at step " << step << std::endl;
+        return false;
+      }
+    } else if (operation == 12 && step % 16 == 0) {
+      name = "clear";
+      list.clear();
+      model.clear();
+    } else {
+      continue;
+    }
+
+    if (!Equal(list, model)) {
+      std::cerr << "lists differ after " << name << " at step " << step << std::endl;
+      return false;
+    }
+  }
+
+  std::cerr << "constructors, assign, insert and resize: passed" << std::endl;
+  return true;
+}
+
+/**
+ * Returns true if list is consistent, has the given values, and all values and nodes in existence are the ones of list.
+ */
+bool HoldsOnly(CountedList& list, const std::vector<int>& values) {
+  list.CheckStatus();
+  size_t backward = 0;
+  for (auto it = list.rbegin(); it != list.rend(); ++it) {
+    ++backward;
+  }
+  std::vector<int> list_values;
+  for (const Tracked& tracked : list) {
+    list_values.push_back(tracked.value);
+  }
+  return list_values == values && backward == list.size() && list.GetStats().live_nodes == list.size() &&
+         Tracked::live == list.size() &&
+         allocator_counters.allocations - allocator_counters.deallocations == list.size();
+}
+
+/**
+ * Makes copies of values throw at a random point of range insertions, assignments and constructions. Insertions must
+ * leave the list unchanged, assignments must leave a valid list, and no values or nodes may leak. Returns true if all
+ * checks passed.
+ */
+bool RunThrowingCopies(const Options& options) {
+  std::mt19937_64 generator(options.seed + 2);
+  auto random = [&generator](size_t bound) {
+    return static_cast<size_t>(generator() % bound);
+  };
+  size_t throws = 0;
+
+  for (size_t step = 0; step < options.operation_count / 10; ++step) {
+    allocator_counters = AllocatorCounters();
+    {
+      std::vector<Tracked> source;
+      for (size_t count = random(12); count > 0; --count) {
+        source.emplace_back(static_cast<int>(random(100)));
+      }
+      CountedList list;
+      for (size_t count = random(12); count > 0; --count) {
+        list.emplace_back(static_cast<int>(random(100)));
+      }
+      std::vector<int> values_before;
+      for (const Tracked& tracked : list) {
+        values_before.push_back(tracked.value);
+      }
+      size_t source_live = source.size();
+      Tracked::live -= source_live;
+
+      size_t operation = random(5);
+      const char* name = "";
+      Tracked::copies_left = random(source.size() + 2);
+      try {
+        if (operation == 0) {
+          name = "insert range";
+          list.insert(IteratorAt(list, random(list.size() + 1)), source.begin(), source.end());
+        } else if (operation == 1) {
+          name = "insert count";
+          list.insert(IteratorAt(list, random(list.size() + 1)), source.size(), Tracked(1));
+        } else if (operation == 2) {
+          name = "assign range";
+          list.assign(source.begin(), source.end());
+        } else if (operation == 3) {
+          name = "assign count";
+          list.assign(source.size(), Tracked(1));
+        } else {
+          name = "range constructor";
+          CountedList constructed(source.begin(), source.end());
+          list = std::move(constructed);
+        }
+        Tracked::copies_left = SIZE_MAX;
+      } catch (const std::runtime_error&) {
+        Tracked::copies_left = SIZE_MAX;
+        ++throws;
+        bool insertion = operation <= 1;
+        std::vector<int> values;
+        for (const Tracked& tracked : list) {
+          values.push_back(tracked.value);
+        }
+        if (!HoldsOnly(list, values) || (insertion && values != values_before)) {
+          std::cerr << name << " with throwing copy broke the list or leaked at step " << step << std::endl;
+          return false;
+        }
+      }
+      Tracked::live += source_live;
+    }
+    if (Tracked::live != 0 || allocator_counters.allocations != allocator_counters.deallocations) {
+      std::cerr << "values or nodes leaked at step " << step << std::endl;
+      return false;
+    }
+  }
+
+  if (throws == 0) {
+    std::cerr << "copies never threw, exception paths were not checked" << std::endl;
+    return false;
+  }
+  std::cerr << "throwing copies: passed, " << throws << " exceptions" << std::endl;
+  return true;
+}
+
+//
+// COUNTERS
+//
+
+size_t Traversals(const CountingInstrumentation::Stats& stats, ListOperation operation) {
+  return stats.traversals[static_cast<size_t>(operation)];
+}
+
+size_t VisitedNodes(const CountingInstrumentation::Stats& stats, ListOperation operation) {
+  return stats.visited_nodes[static_cast<size_t>(operation)];
+}
+
+/**
+ * Runs a fixed sequence of operations on lists with CountingInstrumentation and checks exact values of all counters,
+ * comparing allocations and bytes with the ones seen by the allocator.
+ */
+void TestCounters() {
+  allocator_counters = AllocatorCounters();
+  CountedList list;
+  Tracked value(1);
+  list.push_back(value);
+  list.push_back(Tracked(2));
+  list.emplace_back(3);
+  list.emplace_front(0);
+  list.pop_back();
+
+  auto stats = list.GetStats();
+  size_t node_size = allocator_counters.allocated_bytes / allocator_counters.allocations;
+  Check(stats.allocations == 4 && stats.deallocations == 1, "allocations and deallocations are counted");
+  Check(stats.allocated_bytes == allocator_counters.allocated_bytes && stats.allocated_bytes == 4 * node_size &&
+            stats.deallocated_bytes == node_size, "bytes are the ones requested from the allocator");
+  Check(stats.live_nodes == 3 && stats.peak_live_nodes == 4, "live and peak live nodes are counted");
+  Check(stats.copies == 1 && stats.moves == 1 && stats.emplacements == 2, "copies, moves and emplacements differ");
+  Check(Tracked::live == 4, "pop_back destroys the value");
+
+  CountedList copy(list);
+  stats = copy.GetStats();
+  Check(stats.allocations == 3 && stats.copies == 3 && stats.moves == 0, "copy constructor copies every value");
+  Check(Traversals(stats, ListOperation::kCopy) == 1 && VisitedNodes(stats, ListOperation::kCopy) == 3,
+        "copy is counted as one traversal of its nodes");
+
+  // assignment of a shorter list reuses nodes and destroys the redundant one
+  copy.pop_back();
+  list = copy;
+  stats = list.GetStats();
+  Check(stats.allocations == 4 && stats.deallocations == 2 && stats.copies == 3 && stats.live_nodes == 2,
+        "copy assignment assigns to existing nodes and destroys redundant ones");
+
+  list.reverse();
+  list.unique();
+  list.erase(list.begin(), list.end());
+  stats = list.GetStats();
+  Check(Traversals(stats, ListOperation::kReverse) == 1 && VisitedNodes(stats, ListOperation::kReverse) == 2,
+        "reverse traversal is counted");
+  Check(Traversals(stats, ListOperation::kUnique) == 1 && VisitedNodes(stats, ListOperation::kUnique) == 2,
+        "unique traversal is counted");
+  Check(Traversals(stats, ListOperation::kErase) == 1 && VisitedNodes(stats, ListOperation::kErase) == 2,
+        "range erase traversal is counted");
+  Check(stats.live_nodes == 0 && stats.deallocations == 4, "range erase deallocates nodes");
+
+  // nodes given away by splice and move leave live nodes of the giving list, which must not wrap around
+  list.emplace_back(5);
+  list.emplace_back(6);
+  copy.splice(copy.begin(), list);
+  Check(copy.GetStats().live_nodes == 4 && list.GetStats().live_nodes == 0, "splice transfers live nodes");
+  Check(copy.GetStats().peak_live_nodes == 4, "received nodes update the peak");
+  CountedList moved(std::move(copy));
+  Check(moved.GetStats().live_nodes == 4 && copy.GetStats().live_nodes == 0, "move transfers live nodes");
+  moved.clear();
+  stats = moved.GetStats();
+  // move constructor clears the new list before taking nodes, that is a traversal of no nodes
+  Check(Traversals(stats, ListOperation::kClear) == 2 && VisitedNodes(stats, ListOperation::kClear) == 4,
+        "clear traversal is counted");
+
+  // constructor of value throws, node must be deallocated and not counted
+  size_t allocations_before = allocator_counters.allocations;
+  size_t deallocations_before = allocator_counters.deallocations;
+  CheckThrows<std::runtime_error>([&] { moved.emplace_back(-1); }, "throwing constructor passes exception");
+  Check(allocator_counters.allocations == allocations_before + 1 &&
+            allocator_counters.deallocations == deallocations_before + 1,
+        "node of a value, whose constructor throws, is deallocated");
+  Check(moved.empty() && moved.GetStats().allocations == 0, "node of a failed value is not counted");
+
+  value.value = 7;
+  CountedList dumped;
+  dumped.push_back(value);
+  dumped.emplace_front(8);
+  dumped.reverse();
+  std::ostringstream out;
+  dumped.DumpStats(out);
+  std::string bytes = std::to_string(2 * node_size);
+  Check(out.str() == "list_stats allocations=2 deallocations=0 allocated_bytes=" + bytes +
+                         " deallocated_bytes=0 live_nodes=2 peak_live_nodes=2 copies=1 moves=0 emplacements=1"
+                         " clear_traversals=0 clear_visited_nodes=0 copy_traversals=0 copy_visited_nodes=0"
+                         " erase_traversals=0 erase_visited_nodes=0 unique_traversals=0 unique_visited_nodes=0"
+                         " reverse_traversals=1 reverse_visited_nodes=2 sort_traversals=0 sort_visited_nodes=0"
+                         " merge_traversals=0 merge_visited_nodes=0 splice_traversals=0 splice_visited_nodes=0\n",
+        "DumpStats writes all counters in one line");
+}
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+  bool passed = Run(options);
+  passed &= RunFilling(options);
+  passed &= RunThrowingCopies(options);
+
+  TestCounters();
+  std::cerr << (check_failures == 0 ? "counters: passed" : "counters: FAILED") << std::endl;
+  return passed && check_failures == 0 ? 0 : 1;
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--operations", SizeOption(options.operation_count)},
+                            {"--seed", Uint64Option(options.seed)}});
+  return options;
+}
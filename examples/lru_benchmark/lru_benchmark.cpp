@@ -0,0 +1,243 @@
+#include "../../lru_cache.hpp"
+#include "../../pool_allocator.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct Result {
+  std::string cache;
+  double zipf_exponent;
+  size_t capacity;
+  size_t lookups;
+  double hit_ratio;
+  double ns_per_lookup;
+};
+
+struct Options {
+  size_t key_count = 1000000;
+  size_t trace_length = 2000000;
+  std::string output_path;
+};
+
+Options ParseOptions(int argc, char** argv);
+std::vector<uint64_t> MakeZipfTrace(size_t key_count, double exponent, size_t length, uint64_t seed);
+void WriteJson(std::ostream& out, const std::vector<Result>& results);
+
+//
+// CACHES
+//
+
+using Key = uint64_t;
+using Value = std::string;
+
+Value MakeValue(Key key) {
+  return "cached value for key " + std::to_string(key);
+}
+
+// The usual LRU cache: std::list in recency order and a hash map of its iterators, a hit is a splice to the front
+class StdListCache {
+ public:
+  explicit StdListCache(size_t capacity) : capacity_(capacity) {
+    index_.reserve(capacity);
+  }
+
+  Value* get(Key key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      return nullptr;
+    }
+    order_.splice(order_.begin(), order_, found->second);
+    return &found->second->second;
+  }
+
+  void put(Key key, Value value) {
+    if (order_.size() == capacity_) {
+      index_.erase(order_.back().first);
+      order_.pop_back();
+    }
+    order_.emplace_front(key, std::move(value));
+    index_.emplace(key, order_.begin());
+  }
+
+ private:
+  using Order = std::list<std::pair<Key, Value>>;
+
+  size_t capacity_;
+  Order order_;
+  std::unordered_map<Key, Order::iterator> index_;
+};
+
+// LRU cache on List without splice, as it had to be done before: a hit erases the entry and inserts it again
+class EraseInsertCache {
+ public:
+  explicit EraseInsertCache(size_t capacity) : capacity_(capacity) {
+    index_.reserve(capacity);
+  }
+
+  Value* get(Key key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      return nullptr;
+    }
+    std::pair<Key, Value> entry = std::move(*found->second);
+    order_.erase(found->second);
+    order_.push_front(std::move(entry));
+    found->second = order_.begin();
+    return &order_.front().second;
+  }
+
+  void put(Key key, Value value) {
+    if (order_.size() == capacity_) {
+      index_.erase(order_.back().first);
+      order_.pop_back();
+    }
+    order_.emplace_front(key, std::move(value));
+    index_.emplace(key, order_.begin());
+  }
+
+ private:
+  using Order = List<std::pair<Key, Value>>;
+
+  size_t capacity_;
+  Order order_;
+  std::unordered_map<Key, Order::iterator> index_;
+};
+
+template <typename Allocator>
+class LruCacheAdapter {
+ public:
+  explicit LruCacheAdapter(size_t capacity) : cache_(capacity) {}
+
+  Value* get(Key key) {
+    return cache_.get(key);
+  }
+
+  void put(Key key, Value value) {
+    cache_.put(key, std::move(value));
+  }
+
+ private:
+  LruCache<Key, Value, std::hash<Key>, std::equal_to<Key>, Allocator> cache_;
+};
+
+//
+// MEASURING
+//
+
+/**
+ * Replays trace on a cache of given capacity: every key is looked up, and put on a miss. Returns result with time per
+ * lookup, including puts of missed keys.
+ */
+template <typename Cache>
+Result Replay(const std::string& cache_name, double exponent, size_t capacity, const std::vector<uint64_t>& trace) {
+  Cache cache(capacity);
+
+  size_t hits = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (Key key : trace) {
+    if (Value* value = cache.get(key)) {
+      hits += !value->empty();
+    } else {
+      cache.put(key, MakeValue(key));
+    }
+  }
+  auto finish = std::chrono::steady_clock::now();
+
+  double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+  Result result{cache_name, exponent, capacity, trace.size(), static_cast<double>(hits) / trace.size(),
+                ns / trace.size()};
+  std::cerr << cache_name << " s=" << exponent << " capacity=" << capacity << ": " << result.ns_per_lookup
+            << " ns, hit ratio " << result.hit_ratio << std::endl;
+  return result;
+}
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+
+  std::vector<Result> results;
+  for (double exponent : {0.8, 0.99, 1.2}) {
+    std::vector<uint64_t> trace = MakeZipfTrace(options.key_count, exponent, options.trace_length, 42);
+    for (size_t capacity : {1000, 10000, 100000}) {
+      results.push_back(Replay<LruCacheAdapter<std::allocator<Value>>>("LruCache", exponent, capacity, trace));
+      results.push_back(Replay<LruCacheAdapter<PoolAllocator<Value>>>("LruCache+PoolAllocator", exponent, capacity,
+                                                                      trace));
+      results.push_back(Replay<StdListCache>("std::list+unordered_map", exponent, capacity, trace));
+      results.push_back(Replay<EraseInsertCache>("List erase+insert", exponent, capacity, trace));
+    }
+  }
+
+  if (options.output_path.empty()) {
+    WriteJson(std::cout, results);
+  } else {
+    std::ofstream out(options.output_path);
+    WriteJson(out, results);
+  }
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--keys", SizeOption(options.key_count)},
+                            {"--trace-length", SizeOption(options.trace_length)},
+                            {"--output", StringOption(options.output_path)}});
+  return options;
+}
+
+/**
+ * Returns trace of keys from [0, key_count), where key of rank i is drawn with probability proportional to
+ * 1 / (i + 1)^exponent. Ranks are shuffled over keys, so that popular keys are not neighbours.
+ */
+std::vector<uint64_t> MakeZipfTrace(size_t key_count, double exponent, size_t length, uint64_t seed) {
+  std::vector<double> cumulative(key_count);
+  double sum = 0;
+  for (size_t i = 0; i < key_count; ++i) {
+    sum += 1.0 / std::pow(static_cast<double>(i + 1), exponent);
+    cumulative[i] = sum;
+  }
+
+  std::vector<uint64_t> keys(key_count);
+  for (size_t i = 0; i < key_count; ++i) {
+    keys[i] = i;
+  }
+  std::mt19937_64 generator(seed);
+  std::shuffle(keys.begin(), keys.end(), generator);
+
+  std::uniform_real_distribution<double> distribution(0, sum);
+  std::vector<uint64_t> trace(length);
+  for (auto& key : trace) {
+    auto rank = std::lower_bound(cumulative.begin(), cumulative.end(), distribution(generator)) - cumulative.begin();
+    key = keys[std::min<size_t>(rank, key_count - 1)];
+  }
+  return trace;
+}
+
+//
+// OUTPUT
+//
+
+void WriteJson(std::ostream& out, const std::vector<Result>& results) {
+  WriteJsonHeader(out);
+  out << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    out << "    {\"cache\": \"" << result.cache << "\", "
+        << "\"zipf_exponent\": " << result.zipf_exponent << ", "
+        << "\"capacity\": " << result.capacity << ", "
+        << "\"lookups\": " << result.lookups << ", "
+        << "\"hit_ratio\": " << result.hit_ratio << ", "
+        << "\"ns_per_lookup\": " << result.ns_per_lookup << "}"
+        << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n";
+  out << "}" << std::endl;
+}
@@ -0,0 +1,172 @@
+#include "../../lru_cache.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Value, whose move assignment throws while throw_on_move_assign is set. It owns heap memory, so that lost or doubly
+// destroyed values are seen by sanitizers.
+struct Fragile {
+  static bool throw_on_move_assign;
+
+  std::string data;
+
+  explicit Fragile(std::string data) : data(std::move(data)) {}
+  Fragile(Fragile&& other) = default;
+  Fragile& operator=(Fragile&& other) {
+    if (throw_on_move_assign) {
+      throw std::runtime_error("move assignment failed");
+    }
+    data = std::move(other.data);
+    return *this;
+  }
+};
+
+bool Fragile::throw_on_move_assign = false;
+
+std::string Payload(int key) {
+  return "value that does not fit in the small string buffer " + std::to_string(key);
+}
+
+//
+// CHECKING
+//
+
+/**
+ * Returns true if cache contains exactly keys, calls its CheckStatus and checks that size() is the number of keys.
+ * Does not change recency and counters.
+ */
+template <typename Cache>
+bool HasKeys(const Cache& cache, const std::vector<int>& keys, int max_key) {
+  cache.CheckStatus();
+  size_t found = 0;
+  for (int key = 0; key <= max_key; ++key) {
+    bool expected = std::find(keys.begin(), keys.end(), key) != keys.end();
+    if (cache.contains(key) != expected) {
+      return false;
+    }
+    found += expected;
+  }
+  return cache.size() == found && cache.empty() == (found == 0);
+}
+
+//
+// TESTS
+//
+
+void TestEvictionOrder() {
+  std::vector<int> evicted;
+  LruCache<int, std::string> cache(3, std::numeric_limits<size_t>::max(),
+                                   [&evicted](const int& key, std::string& value) {
+                                     Check(value == Payload(key), "callback gets the value of evicted key");
+                                     evicted.push_back(key);
+                                   });
+  for (int key = 0; key < 3; ++key) {
+    cache.put(key, Payload(key));
+  }
+  Check(cache.get(0) != nullptr, "hit");
+  Check(cache.get(7) == nullptr, "miss");
+  // recency order is 0, 2, 1, so 1 and then 2 are evicted
+  cache.put(3, Payload(3));
+  cache.put(4, Payload(4));
+  Check(evicted == std::vector<int>({1, 2}), "least recently used entries are evicted first");
+  Check(HasKeys(cache, {0, 3, 4}, 7), "cache has the recently used keys");
+
+  // put of an existing key updates it and makes it the most recently used one without eviction
+  cache.put(0, Payload(0));
+  cache.put(5, Payload(5));
+  Check(evicted == std::vector<int>({1, 2, 3}), "put of existing key makes it recently used");
+  Check(HasKeys(cache, {0, 4, 5}, 7), "cache has the recently put keys");
+
+  // erase and clear do not call the callback
+  Check(cache.erase(4) && !cache.erase(4), "erase returns whether there was the key");
+  cache.clear();
+  Check(evicted.size() == 3 && HasKeys(cache, {}, 7), "erase and clear do not evict");
+
+  LruCache<int, std::string>::Stats stats = cache.GetStats();
+  Check(stats.hits == 1 && stats.misses == 1 && stats.evictions == 3, "hits, misses and evictions are counted");
+  cache.ResetStats();
+  stats = cache.GetStats();
+  Check(stats.hits == 0 && stats.misses == 0 && stats.evictions == 0, "counters are reset");
+
+  LruCache<int, std::string> empty_cache(0);
+  empty_cache.put(1, Payload(1));
+  Check(empty_cache.empty() && empty_cache.get(1) == nullptr, "cache with 0 entries stores nothing");
+}
+
+void TestByteBound() {
+  std::vector<int> evicted;
+  LruCache<int, std::string> cache(100, 100, [&evicted](const int& key, std::string&) { evicted.push_back(key); });
+  cache.put(0, Payload(0), 40);
+  cache.put(1, Payload(1), 40);
+  cache.put(2, Payload(2), 10);
+  Check(cache.bytes() == 90 && evicted.empty(), "entries within bounds are not evicted");
+
+  cache.put(3, Payload(3), 50);
+  Check(evicted == std::vector<int>({0}) && cache.bytes() == 100, "entries are evicted until bytes are in bound");
+  Check(HasKeys(cache, {1, 2, 3}, 5), "cache has the recently used keys after byte eviction");
+
+  // a larger size of an existing key evicts older entries, but not the key itself
+  cache.put(2, Payload(2), 50);
+  Check(evicted == std::vector<int>({0, 1}) && cache.bytes() == 100, "updated size is counted");
+  Check(HasKeys(cache, {2, 3}, 5), "updated key stays");
+
+  // an entry larger than max_bytes is evicted right after put, together with all others
+  cache.put(4, Payload(4), 101);
+  Check(evicted == std::vector<int>({0, 1, 3, 2, 4}) && cache.bytes() == 0, "too large entry is evicted");
+  Check(HasKeys(cache, {}, 5), "cache is empty after too large entry");
+  Check(cache.GetStats().evictions == 5, "byte evictions are counted");
+}
+
+void TestThrowingValue() {
+  std::vector<int> evicted;
+  LruCache<int, Fragile> cache(2, std::numeric_limits<size_t>::max(),
+                               [&evicted](const int& key, Fragile&) { evicted.push_back(key); });
+  cache.put(0, Fragile(Payload(0)), 10);
+  cache.put(1, Fragile(Payload(1)), 20);
+
+  // a full cache reuses the node of key 0 for key 2, assignment of value throws
+  Fragile::throw_on_move_assign = true;
+  bool thrown = false;
+  try {
+    cache.put(2, Fragile(Payload(2)), 30);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  Check(thrown, "exception of reused entry is passed to the caller");
+  Check(HasKeys(cache, {1}, 3), "evicted entry is removed and the new one is not inserted");
+  Check(cache.bytes() == 20, "bytes of removed entry are not counted");
+  Check(evicted == std::vector<int>({0}) && cache.GetStats().evictions == 1, "eviction before exception is counted");
+
+  // update of an existing key, assignment of value throws
+  thrown = false;
+  try {
+    cache.put(1, Fragile(Payload(3)), 40);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  Check(thrown, "exception of updated entry is passed to the caller");
+  Check(HasKeys(cache, {1}, 3) && cache.bytes() == 20, "entry, which failed to update, keeps its size");
+
+  Fragile::throw_on_move_assign = false;
+  cache.put(2, Fragile(Payload(2)), 30);
+  cache.put(3, Fragile(Payload(3)), 40);
+  Check(HasKeys(cache, {2, 3}, 3) && cache.bytes() == 70, "cache works after exceptions");
+  Check(cache.get(3) != nullptr && cache.get(3)->data == Payload(3), "value is stored after exceptions");
+}
+
+int main() {
+  TestEvictionOrder();
+  TestByteBound();
+  TestThrowingValue();
+
+  std::cerr << (check_failures == 0 ? "lru cache: passed" : "lru cache: FAILED") << std::endl;
+  return check_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,211 @@
+#include "../../list.hpp"
+#include "../../pool_allocator.hpp"
+
+#include "harness.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <set>
+#include <type_traits>
+#include <vector>
+
+//
+// GLOBAL HEAP
+//
+
+// PoolAllocator requests slabs and arrays from the global heap by the aligned operator new, so counting its calls
+// shows whether an allocation was served by a pool. Other allocations of the test use the plain operator new and are
+// not counted.
+
+size_t heap_allocations = 0;
+size_t heap_deallocations = 0;
+
+void* operator new(size_t size, std::align_val_t alignment) {
+  ++heap_allocations;
+  auto align = static_cast<size_t>(alignment);
+  void* raw = std::malloc(size + align + sizeof(void*));
+  if (raw == nullptr) {
+    throw std::bad_alloc();
+  }
+  // the pointer returned by malloc is stored right before the aligned block
+  uintptr_t aligned = (reinterpret_cast<uintptr_t>(raw) + sizeof(void*) + align - 1) / align * align;
+  reinterpret_cast<void**>(aligned)[-1] = raw;
+  return reinterpret_cast<void*>(aligned);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  if (pointer != nullptr) {
+    ++heap_deallocations;
+    std::free(static_cast<void**>(pointer)[-1]);
+  }
+}
+
+void operator delete(void* pointer, size_t, std::align_val_t alignment) noexcept {
+  operator delete(pointer, alignment);
+}
+
+//
+// VALUES
+//
+
+struct Big {
+  char bytes[64];
+};
+
+constexpr size_t kSlabSize = 4;
+
+//
+// TESTS
+//
+
+void TestFreeListReuse() {
+  PoolAllocator<int, kSlabSize> alloc;
+  size_t allocations = heap_allocations;
+
+  std::vector<int*> pointers;
+  for (size_t i = 0; i < kSlabSize; ++i) {
+    pointers.push_back(alloc.allocate(1));
+  }
+  Check(heap_allocations == allocations + 1, "one slab serves the first SlabSize allocations");
+  Check(std::set<int*>(pointers.begin(), pointers.end()).size() == kSlabSize, "slots of a slab are distinct");
+
+  alloc.deallocate(pointers[1], 1);
+  alloc.deallocate(pointers[2], 1);
+  int* reused_last = alloc.allocate(1);
+  int* reused_first = alloc.allocate(1);
+  Check(reused_last == pointers[2] && reused_first == pointers[1], "released slots are reused, last released first");
+  Check(heap_allocations == allocations + 1, "reused slots do not request a slab");
+
+  int* next = alloc.allocate(1);
+  Check(heap_allocations == allocations + 2, "a new slab is requested when slabs and free list are exhausted");
+
+  for (int* pointer : pointers) {
+    alloc.deallocate(pointer, 1);
+  }
+  alloc.deallocate(next, 1);
+}
+
+void TestRelease() {
+  PoolAllocator<int, kSlabSize> alloc;
+  std::vector<int*> pointers;
+  for (size_t i = 0; i < 2 * kSlabSize; ++i) {
+    pointers.push_back(alloc.allocate(1));
+  }
+
+  size_t deallocations = heap_deallocations;
+  alloc.deallocate(pointers.back(), 1);
+  pointers.pop_back();
+  alloc.release();
+  Check(heap_deallocations == deallocations, "release() keeps slabs while there are live objects");
+
+  for (int* pointer : pointers) {
+    alloc.deallocate(pointer, 1);
+  }
+  alloc.release();
+  Check(heap_deallocations == deallocations + 2, "release() returns all slabs after all objects are freed");
+
+  size_t allocations = heap_allocations;
+  int* pointer = alloc.allocate(1);
+  Check(heap_allocations == allocations + 1, "allocation after release() requests a new slab");
+  alloc.deallocate(pointer, 1);
+}
+
+void TestReserve() {
+  PoolAllocator<int, kSlabSize> alloc;
+  int* first = alloc.allocate(1);
+
+  size_t allocations = heap_allocations;
+  alloc.reserve(100);
+  Check(heap_allocations == allocations + 1, "reserve() requests one slab for all reserved objects");
+
+  std::vector<int*> pointers;
+  for (size_t i = 0; i < 100; ++i) {
+    pointers.push_back(alloc.allocate(1));
+  }
+  Check(heap_allocations == allocations + 1, "reserved allocations do not request slabs");
+  std::set<int*> distinct(pointers.begin(), pointers.end());
+  Check(distinct.size() == 100 && distinct.count(first) == 0, "reserved slots are distinct and not live");
+
+  for (int* pointer : pointers) {
+    alloc.deallocate(pointer, 1);
+  }
+  alloc.reserve(50);
+  Check(heap_allocations == allocations + 1, "reserve() does nothing if enough slots are free");
+  alloc.deallocate(first, 1);
+}
+
+void TestSharing() {
+  static_assert(std::is_nothrow_constructible_v<PoolAllocator<Big, kSlabSize>, const PoolAllocator<int, kSlabSize>&>,
+                "Rebinding an allocator must not throw");
+  PoolAllocator<int, kSlabSize> ints;
+  PoolAllocator<Big, kSlabSize> bigs(ints);
+  PoolAllocator<int, kSlabSize> ints_again(bigs);
+  PoolAllocator<int, kSlabSize> other;
+  Check(ints == bigs && bigs == ints_again && ints == ints_again, "rebound copies are equal");
+  Check(ints != other && !(ints == other), "allocators with different resources are not equal");
+
+  // ints_again has not allocated yet, it finds the pool of ints on deallocation
+  int* pointer = ints.allocate(1);
+  ints_again.deallocate(pointer, 1);
+  Check(ints.allocate(1) == pointer, "rebound copies share the pool of a type");
+  ints.deallocate(pointer, 1);
+
+  Big* big = bigs.allocate(1);
+  Check(reinterpret_cast<char*>(big) != reinterpret_cast<char*>(pointer), "larger type gets a pool of its own");
+  bigs.deallocate(big, 1);
+
+  other = ints;
+  Check(other == ints, "assigned allocator shares the resource");
+  int* shared = other.allocate(1);
+  ints.deallocate(shared, 1);
+  Check(ints.allocate(1) == shared, "assigned allocator shares the pool");
+  ints.deallocate(shared, 1);
+}
+
+void TestArrays() {
+  PoolAllocator<int, kSlabSize> alloc;
+  size_t allocations = heap_allocations;
+  size_t deallocations = heap_deallocations;
+
+  int* array = alloc.allocate(3);
+  Check(heap_allocations == allocations + 1, "allocate(n > 1) requests memory from the global heap");
+  array[0] = array[1] = array[2] = 1;
+  alloc.deallocate(array, 3);
+  Check(heap_deallocations == deallocations + 1, "deallocate(n > 1) returns memory to the global heap");
+
+  int* single = alloc.allocate(1);
+  Check(heap_allocations == allocations + 2, "array allocation does not create a slab");
+  alloc.deallocate(single, 1);
+}
+
+void TestList() {
+  size_t allocations = heap_allocations;
+  size_t deallocations = heap_deallocations;
+  {
+    List<int, PoolAllocator<int, 16>> list;
+    for (int i = 0; i < 100; ++i) {
+      list.push_back(i);
+    }
+    Check(heap_allocations == allocations + 7, "100 nodes of List take 7 slabs of 16");
+
+    List<int, PoolAllocator<int, 16>> copy(list);
+    copy.clear();
+    Check(heap_deallocations == deallocations, "clear() of a copy keeps slabs with nodes of the original");
+  }
+  Check(heap_deallocations - deallocations == heap_allocations - allocations,
+        "destroyed lists return all slabs to the global heap");
+}
+
+int main() {
+  TestFreeListReuse();
+  TestRelease();
+  TestReserve();
+  TestSharing();
+  TestArrays();
+  TestList();
+
+  std::cerr << (check_failures == 0 ? "pool allocator: passed" : "pool allocator: FAILED") << std::endl;
+  return check_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,158 @@
+#include "../../list_snapshot.hpp"
+#include "../../list_snapshot_mmap.hpp"
+#include "../../pool_allocator.hpp"
+
+#include "harness.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+struct Result {
+  std::string operation;
+  std::string container;
+  size_t values;
+  double ns_per_value;
+};
+
+struct Options {
+  size_t value_count = 10000000;
+  std::string path = "snapshot_benchmark.snap";
+  std::string output_path;
+};
+
+Options ParseOptions(int argc, char** argv);
+void WriteJson(std::ostream& out, const std::vector<Result>& results);
+
+//
+// MEASURING
+//
+
+uint64_t expected_sum = 0;
+
+template <typename Container>
+uint64_t Sum(const Container& values) {
+  uint64_t sum = 0;
+  for (int value : values) {
+    sum += static_cast<uint64_t>(value);
+  }
+  return sum;
+}
+
+void CheckSum(const std::string& name, uint64_t sum) {
+  if (sum != expected_sum) {
+    std::cerr << name << ": wrong sum of values" << std::endl;
+    std::exit(1);
+  }
+}
+
+/**
+ * Runs action once and returns result with its time per value. action returns the sum of values it has restored or
+ * scanned, which is checked, so that the work cannot be optimized away.
+ */
+Result Measure(const std::string& operation, const std::string& container, size_t value_count,
+               const std::function<uint64_t()>& action) {
+  auto start = std::chrono::steady_clock::now();
+  uint64_t sum = action();
+  auto finish = std::chrono::steady_clock::now();
+  CheckSum(operation + " " + container, sum);
+
+  double ns = std::chrono::duration<double, std::nano>(finish - start).count();
+  Result result{operation, container, value_count, ns / value_count};
+  std::cerr << operation << " " << container << ": " << result.ns_per_value << " ns per value" << std::endl;
+  return result;
+}
+
+/**
+ * Restores values from path one by one, as without ReadSnapshot: reads one value and pushes it back.
+ */
+uint64_t ReadOneByOne(const std::string& path, List<int>& list) {
+  std::ifstream in(path, std::ios::binary);
+  SnapshotHeader header;
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  CheckSnapshotHeader<int>(header);
+  in.seekg(static_cast<std::streamoff>(header.data_offset));
+  list.clear();
+  int value = 0;
+  for (uint64_t i = 0; i < header.count && in.read(reinterpret_cast<char*>(&value), sizeof(value)); ++i) {
+    list.push_back(value);
+  }
+  return Sum(list);
+}
+
+template <typename Allocator>
+uint64_t Restore(const std::string& path, List<int, Allocator>& list) {
+  std::ifstream in(path, std::ios::binary);
+  ReadSnapshot(in, list);
+  return Sum(list);
+}
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+  size_t count = options.value_count;
+  const std::string& path = options.path;
+
+  List<int> list;
+  for (size_t i = 0; i < count; ++i) {
+    list.push_back(static_cast<int>(i * 2654435761u));
+  }
+  expected_sum = Sum(list);
+
+  std::vector<Result> results;
+  results.push_back(Measure("write", "List", count, [&] {
+    std::ofstream out(path, std::ios::binary);
+    WriteSnapshot(out, list);
+    return expected_sum;
+  }));
+  // restored lists are destroyed outside of measured time, as it is the same for all ways of restoring
+  List<int> restored;
+  results.push_back(Measure("restore one by one", "List", count, [&] { return ReadOneByOne(path, restored); }));
+  restored.clear();
+  results.push_back(Measure("restore", "List", count, [&] { return Restore(path, restored); }));
+  List<int, PoolAllocator<int>> pooled;
+  results.push_back(Measure("restore", "List+PoolAllocator", count, [&] { return Restore(path, pooled); }));
+  results.push_back(Measure("scan", "List", count, [&] { return Sum(restored); }));
+  results.push_back(Measure("scan", "List+PoolAllocator", count, [&] { return Sum(pooled); }));
+  results.push_back(Measure("map and scan", "MappedListView", count, [&] { return Sum(MappedListView<int>(path)); }));
+  std::remove(path.c_str());
+
+  if (options.output_path.empty()) {
+    WriteJson(std::cout, results);
+  } else {
+    std::ofstream out(options.output_path);
+    WriteJson(out, results);
+  }
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--values", SizeOption(options.value_count)},
+                            {"--path", StringOption(options.path)},
+                            {"--output", StringOption(options.output_path)}});
+  return options;
+}
+
+//
+// OUTPUT
+//
+
+void WriteJson(std::ostream& out, const std::vector<Result>& results) {
+  WriteJsonHeader(out);
+  out << "  \"results\": [\n";
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    out << "    {\"operation\": \"" << result.operation << "\", "
+        << "\"container\": \"" << result.container << "\", "
+        << "\"values\": " << result.values << ", "
+        << "\"ns_per_value\": " << result.ns_per_value << "}"
+        << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  out << "  ]\n";
+  out << "}" << std::endl;
+}
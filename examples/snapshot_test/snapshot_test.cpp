@@ -0,0 +1,215 @@
+#include "../../list_snapshot.hpp"
+#include "../../list_snapshot_mmap.hpp"
+#include "../../pool_allocator.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <system_error>
+
+// Trivially copyable value, which is stored raw
+struct Point {
+  int32_t x;
+  int32_t y;
+  double weight;
+};
+
+// Stream buffer over a string, which cannot seek, like a pipe
+class UnseekableBuffer : public std::streambuf {
+ public:
+  explicit UnseekableBuffer(std::string data) : data_(std::move(data)) {
+    setg(data_.data(), data_.data(), data_.data() + data_.size());
+  }
+
+ private:
+  std::string data_;
+};
+
+const char* const kPath = "snapshot_test.snap";
+
+//
+// CHECKING
+//
+
+template <typename ListA, typename ListB>
+bool SameValues(const ListA& first, const ListB& second) {
+  return first.size() == second.size() && std::equal(first.begin(), first.end(), second.begin());
+}
+
+bool operator==(const Point& left, const Point& right) {
+  return left.x == right.x && left.y == right.y && left.weight == right.weight;
+}
+
+template <typename T>
+std::string ToSnapshot(const List<T>& list) {
+  std::ostringstream out;
+  WriteSnapshot(out, list);
+  return out.str();
+}
+
+void WriteFile(const std::string& bytes) {
+  std::ofstream out(kPath, std::ios::binary);
+  out << bytes;
+}
+
+//
+// TESTS
+//
+
+void TestRawRoundTrip() {
+  // more values than fit in one block of 64 KiB, so that reading and writing cross block boundaries
+  List<int> ints;
+  for (int i = 0; i < 100000; ++i) {
+    ints.push_back(i * 7 - 1000);
+  }
+  std::string bytes = ToSnapshot(ints);
+  Check(bytes.size() == sizeof(SnapshotHeader) + ints.size() * sizeof(int), "raw snapshot has header and values");
+
+  std::istringstream in(bytes);
+  List<int> restored{1, 2, 3};
+  ReadSnapshot(in, restored);
+  Check(SameValues(restored, ints), "raw values are restored and old ones replaced");
+
+  std::istringstream pool_in(bytes);
+  List<int, PoolAllocator<int>> pooled;
+  ReadSnapshot(pool_in, pooled);
+  Check(SameValues(pooled, ints), "raw values are restored into List with PoolAllocator");
+
+  List<Point> points{{1, 2, 0.5}, {-3, 4, 1e10}, {5, -6, -0.25}};
+  std::istringstream points_in(ToSnapshot(points));
+  List<Point> restored_points;
+  ReadSnapshot(points_in, restored_points);
+  Check(SameValues(restored_points, points), "raw structures are restored");
+
+  std::istringstream empty_in(ToSnapshot(List<int>()));
+  ReadSnapshot(empty_in, restored);
+  Check(restored.empty(), "empty snapshot restores empty list");
+}
+
+void TestStringRoundTrip() {
+  List<std::string> strings{"", "short", std::string(1000, 'a'), std::string(200000, 'b'), "", "last"};
+  std::string bytes = ToSnapshot(strings);
+
+  std::istringstream in(bytes);
+  List<std::string> restored;
+  ReadSnapshot(in, restored);
+  Check(SameValues(restored, strings), "strings are restored from a seekable stream");
+
+  // a stream, which cannot tell the number of characters left, reads long strings in blocks
+  UnseekableBuffer buffer(bytes);
+  std::istream unseekable(&buffer);
+  List<std::string> restored_unseekable;
+  ReadSnapshot(unseekable, restored_unseekable);
+  Check(SameValues(restored_unseekable, strings), "strings are restored from a stream, which cannot seek");
+}
+
+void TestRejected() {
+  List<int> ints{1, 2, 3, 4, 5};
+  std::string bytes = ToSnapshot(ints);
+  List<int> restored;
+
+  for (size_t length : {size_t(0), size_t(10), sizeof(SnapshotHeader), bytes.size() - 1}) {
+    CheckThrows<std::runtime_error>([&] {
+      std::istringstream in(bytes.substr(0, length));
+      ReadSnapshot(in, restored);
+    }, "snapshot truncated to " + std::to_string(length) + " bytes is rejected");
+  }
+
+  CheckThrows<std::runtime_error>([&] {
+    std::istringstream in(bytes);
+    List<int64_t> wrong;
+    ReadSnapshot(in, wrong);
+  }, "snapshot of int is rejected as int64_t");
+  CheckThrows<std::runtime_error>([&] {
+    std::istringstream in(bytes);
+    List<std::string> wrong;
+    ReadSnapshot(in, wrong);
+  }, "snapshot of int is rejected as std::string");
+  CheckThrows<std::runtime_error>([&] {
+    std::istringstream in(ToSnapshot(List<std::string>{"text"}));
+    ReadSnapshot(in, restored);
+  }, "snapshot of std::string is rejected as int");
+
+  // data_offset points past the end of an empty snapshot, so that the padding before values is missing
+  std::string short_padding = ToSnapshot(List<int>());
+  uint64_t data_offset = 4096;
+  std::memcpy(&short_padding[offsetof(SnapshotHeader, data_offset)], &data_offset, sizeof(data_offset));
+  CheckThrows<std::runtime_error>([&] {
+    std::istringstream in(short_padding);
+    ReadSnapshot(in, restored);
+  }, "snapshot shorter than its data offset is rejected");
+
+  std::string wrong_magic = bytes;
+  wrong_magic[0] = 'X';
+  CheckThrows<std::runtime_error>([&] {
+    std::istringstream in(wrong_magic);
+    ReadSnapshot(in, restored);
+  }, "snapshot with wrong magic is rejected");
+
+  // length of the first string is replaced with 2^40, which must be rejected before allocating it
+  std::string huge_length = ToSnapshot(List<std::string>{"text", "more text"});
+  uint64_t length = uint64_t(1) << 40;
+  std::memcpy(&huge_length[sizeof(SnapshotHeader)], &length, sizeof(length));
+  CheckThrows<std::runtime_error>([&] {
+    std::istringstream in(huge_length);
+    List<std::string> strings;
+    ReadSnapshot(in, strings);
+  }, "string longer than the rest of a seekable stream is rejected");
+  CheckThrows<std::runtime_error>([&] {
+    UnseekableBuffer buffer(huge_length);
+    std::istream in(&buffer);
+    List<std::string> strings;
+    ReadSnapshot(in, strings);
+  }, "string longer than the rest of a stream, which cannot seek, is rejected");
+}
+
+void TestMappedView() {
+  List<Point> points;
+  for (int i = 0; i < 10000; ++i) {
+    points.push_back(Point{i, -i, i * 0.5});
+  }
+  std::string bytes = ToSnapshot(points);
+  WriteFile(bytes);
+  {
+    MappedListView<Point> view(kPath);
+    Check(SameValues(view, points), "mapped view has the same values");
+    Check(view.front() == points.front() && view.back() == points.back(), "mapped view front and back");
+    Check(std::equal(view.rbegin(), view.rend(), points.rbegin()), "mapped view reverse iteration");
+
+    MappedListView<Point> moved(std::move(view));
+    Check(view.empty() && moved.size() == points.size(), "mapped view is moved");
+  }
+
+  WriteFile(ToSnapshot(List<int>()));
+  Check(MappedListView<int>(kPath).empty(), "mapped view of empty snapshot is empty");
+
+  WriteFile(bytes.substr(0, bytes.size() - 1));
+  CheckThrows<std::runtime_error>([] { MappedListView<Point> view(kPath); }, "truncated file is not mapped");
+  WriteFile(bytes.substr(0, 8));
+  CheckThrows<std::runtime_error>([] { MappedListView<Point> view(kPath); }, "file shorter than header is not mapped");
+  WriteFile(bytes);
+  CheckThrows<std::runtime_error>([] { MappedListView<int> view(kPath); }, "file of other value type is not mapped");
+
+  std::remove(kPath);
+  CheckThrows<std::system_error>([] { MappedListView<Point> view(kPath); }, "missing file is not mapped");
+}
+
+int main() {
+  TestRawRoundTrip();
+  TestStringRoundTrip();
+  TestRejected();
+  TestMappedView();
+
+  std::cerr << (check_failures == 0 ? "snapshots: passed" : "snapshots: FAILED") << std::endl;
+  return check_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,265 @@
+#include "../../unrolled_list.hpp"
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+
+struct Options {
+  size_t operation_count = 200000;
+  uint64_t seed = 42;
+};
+
+Options ParseOptions(int argc, char** argv);
+
+//
+// CHECKING
+//
+
+// Values own heap memory, so that lost, copied over or doubly destroyed values are seen by sanitizers. Only a few
+// different values are used, so that unique has groups to remove.
+std::string MakeValue(std::mt19937_64& generator) {
+  return "value that does not fit in the small string buffer " + std::to_string(generator() % 8);
+}
+
+template <typename List>
+typename List::iterator IteratorAt(List& list, size_t index) {
+  return std::next(list.begin(), static_cast<std::ptrdiff_t>(index));
+}
+
+/**
+ * Returns true if list has the same values as model, both forwards and backwards, and its chunks are linked correctly.
+ */
+template <typename Unrolled>
+bool Equal(Unrolled& list, const std::list<std::string>& model) {
+  list.CheckStatus();
+  if (list.size() != model.size() || list.empty() != model.empty()) {
+    return false;
+  }
+  const auto list_begin = list.cbegin();
+  const auto list_end = list.cend();
+  if ((list_begin == list_end) != model.empty() || (list_begin != list_end) == model.empty()) {
+    return false;
+  }
+  auto model_it = model.begin();
+  for (auto it = list.begin(); it != list.end(); ++it, ++model_it) {
+    if (model_it == model.end() || *it != *model_it) {
+      return false;
+    }
+  }
+  if (model_it != model.end()) {
+    return false;
+  }
+  auto model_reverse_it = model.rbegin();
+  for (auto it = list.rbegin(); it != list.rend(); ++it, ++model_reverse_it) {
+    if (*it != *model_reverse_it) {
+      return false;
+    }
+  }
+  return model.empty() || (list.front() == model.front() && list.back() == model.back());
+}
+
+//
+// RUNNING
+//
+
+/**
+ * Applies operation_count random operations to UnrolledList with given chunk capacity and to std::list and compares
+ * them after every operation. Insertions and erasures are done at random positions, so that they happen in the middle
+ * of chunks and on their boundaries and split and merge chunks. The size of the list drifts up and down, so that
+ * chunks are both split and merged many times. Returns true if lists stayed equal.
+ */
+template <size_t ChunkCapacity>
+bool Run(const Options& options) {
+  using Unrolled = UnrolledList<std::string, ChunkCapacity>;
+  std::mt19937_64 generator(options.seed + ChunkCapacity);
+  Unrolled list;
+  std::list<std::string> model;
+
+  // list grows while target_size is greater than its size and shrinks otherwise
+  size_t target_size = 0;
+  for (size_t step = 0; step < options.operation_count; ++step) {
+    if (step % 1000 == 0) {
+      target_size = generator() % 200;
+    }
+    bool grow = model.size() < target_size;
+    size_t operation = generator() % 16;
+    size_t index = model.empty() ? 0 : generator() % (model.size() + 1);
+    const char* name = "";
+
+    if (grow && operation < 8) {
+      std::string value = MakeValue(generator);
+      if (operation == 0) {
+        name = "push_back";
+        list.push_back(value);
+        model.push_back(value);
+      } else if (operation == 1) {
+        name = "push_front";
+        list.push_front(value);
+        model.push_front(value);
+      } else if (operation == 2) {
+        name = "emplace_back";
+        list.emplace_back(value);
+        model.emplace_back(value);
+      } else if (operation == 3) {
+        name = "emplace";
+        list.emplace(IteratorAt(list, index), value);
+        model.emplace(IteratorAt(model, index), value);
+      } else {
+        name = "insert";
+        auto it = list.insert(IteratorAt(list, index), value);
+        auto model_it = model.insert(IteratorAt(model, index), value);
+        if (std::distance(list.begin(), it) != std::distance(model.begin(), model_it) || *it != value) {
+          std::cerr << "capacity " << ChunkCapacity << ": insert returned wrong iterator at step " << step
+                    << std::endl;
+          return false;
+        }
+      }
+    } else if (!grow && !model.empty() && operation < 8) {
+      index = std::min(index, model.size() - 1);
+      if (operation == 0) {
+        name = "pop_back";
+        list.pop_back();
+        model.pop_back();
+      } else if (operation == 1) {
+        name = "pop_front";
+        list.pop_front();
+        model.pop_front();
+      } else if (operation < 6) {
+        name = "erase";
+        auto it = list.erase(IteratorAt(list, index));
+        auto model_it = model.erase(IteratorAt(model, index));
+        if (std::distance(list.begin(), it) != std::distance(model.begin(), model_it)) {
+          std::cerr << "capacity " << ChunkCapacity << ": erase returned wrong iterator at step " << step
+                    << std::endl;
+          return false;
+        }
+      } else {
+        name = "erase range";
+        // ranges are up to three chunks long, so that they cover whole chunks and both boundary chunks
+        size_t count = std::min<size_t>(generator() % (3 * ChunkCapacity), model.size() - index);
+        auto it = list.erase(IteratorAt(list, index), IteratorAt(list, index + count));
+        auto model_it = model.erase(IteratorAt(model, index), IteratorAt(model, index + count));
+        if (std::distance(list.begin(), it) != std::distance(model.begin(), model_it)) {
+          std::cerr << "capacity " << ChunkCapacity << ": erase range returned wrong iterator at step " << step
+                    << std::endl;
+          return false;
+        }
+      }
+    } else if (operation == 8) {
+      name = "reverse";
+      list.reverse();
+      model.reverse();
+    } else if (operation == 9) {
+      name = "unique";
+      list.unique();
+      model.unique();
+    } else if (operation == 10 && step % 64 == 0) {
+      name = "copy";
+      Unrolled copy(list);
+      list = copy;
+      if (!Equal(copy, model)) {
+        std::cerr << "capacity " << ChunkCapacity << ": copy differs at step " << step << std::endl;
+        return false;
+      }
+    } else if (operation == 11 && step % 64 == 0) {
+      name = "move";
+      Unrolled moved(std::move(list));
+      list = std::move(moved);
+    } else if (operation == 12 && step % 512 == 0) {
+      name = "clear";
+      list.clear();
+      model.clear();
+    } else {
+      continue;
+    }
+
+    if (!Equal(list, model)) {
+      std::cerr << "capacity " << ChunkCapacity << ": lists differ after " << name << " at step " << step
+                << std::endl;
+      return false;
+    }
+  }
+
+  std::cerr << "capacity " << ChunkCapacity << ": passed" << std::endl;
+  return true;
+}
+
+// Value, which counts its moves
+struct Counted {
+  static size_t moves;
+
+  int value;
+
+  explicit Counted(int value) : value(value) {}
+  Counted(Counted&& other) noexcept : value(other.value) {
+    ++moves;
+  }
+  Counted& operator=(Counted&& other) noexcept {
+    value = other.value;
+    ++moves;
+    return *this;
+  }
+};
+
+size_t Counted::moves = 0;
+
+/**
+ * Checks that emplace constructs the value in place, without moves, when there is a free slot before the position:
+ * at the front of its chunk or at the back of the previous chunk. Returns true if it does.
+ */
+bool RunInPlaceEmplace() {
+  UnrolledList<Counted, 4> list;
+  // push_front fills chunks from the back, so the front chunk has free slots before its first value
+  list.emplace_front(2);
+  list.emplace_front(1);
+  Counted::moves = 0;
+  list.emplace(list.begin(), 0);
+  bool at_chunk_front = Counted::moves == 0 && list.front().value == 0;
+
+  // push_back fills chunks from the front, so the first chunk has free slots after its last value
+  UnrolledList<Counted, 4> appended;
+  for (int i = 0; i < 6; ++i) {
+    appended.emplace_back(i);
+  }
+  appended.erase(std::next(appended.begin(), 3));
+  // chunks are {0, 1, 2} and {4, 5}, the position of value 4 has a free slot before it in the first chunk
+  Counted::moves = 0;
+  appended.emplace(std::next(appended.begin(), 3), 3);
+  bool at_prev_back = Counted::moves == 0;
+  appended.CheckStatus();
+  int expected = 0;
+  for (const Counted& counted : appended) {
+    at_prev_back &= counted.value == expected++;
+  }
+
+  if (!at_chunk_front || !at_prev_back || expected != 6) {
+    std::cerr << "emplace moved values although a free slot was before its position" << std::endl;
+    return false;
+  }
+  std::cerr << "in place emplace: passed" << std::endl;
+  return true;
+}
+
+int main(int argc, char** argv) {
+  Options options = ParseOptions(argc, argv);
+
+  bool passed = RunInPlaceEmplace();
+  passed &= Run<2>(options);
+  passed &= Run<3>(options);
+  passed &= Run<16>(options);
+
+  return passed ? 0 : 1;
+}
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  ParseOptions(argc, argv, {{"--operations", SizeOption(options.operation_count)},
+                            {"--seed", Uint64Option(options.seed)}});
+  return options;
+}
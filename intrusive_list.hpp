@@ -0,0 +1,171 @@
+//
+// Class IntrusiveList implements a double-linked list of objects, which are owned by the user.
+//
+
+// Unlike List, IntrusiveList does not allocate nodes and does not construct, copy or destroy values. The type T of
+// linked objects has a member of type IntrusiveListHook, and template parameter Member describes it: the pointer to
+// the member and its offset in T. INTRUSIVE_LIST_MEMBER(T, hook) names the IntrusiveListMember for member hook. The
+// list links the hooks of objects, which stay where the user put them (on stack, in an arena, in a pool). An object
+// may have several hooks and be in several lists at once, one list per hook:
+
+//   struct Task {
+//     IntrusiveListHook all_hook;
+//     IntrusiveListHook ready_hook;
+//   };
+//   IntrusiveList<Task, INTRUSIVE_LIST_MEMBER(Task, all_hook)> all_tasks;
+//   IntrusiveList<Task, INTRUSIVE_LIST_MEMBER(Task, ready_hook)> ready_tasks;
+
+// The design is the one of List: the list owns a sentinel hook "end_", end_.next is the hook of the front object,
+// end_.prev of the back one. Iterators are RingIterator of list.hpp, the same template as in List, with the hook as
+// node: the object is found from its hook by the offset of the hook in T, taken by offsetof, so T must be a
+// standard-layout type. A hook, which is not in a list, has null links. Copies of a hook are not linked, so copying T
+// does not break lists; moving T does not move links either.
+
+// The user is responsible for lifetime: an object must be unlinked before it is destroyed (in debug mode the destructor
+// of hook checks it), and a list unlinks all its objects when it is cleared or destroyed. erase(T& object) unlinks an
+// object in constant time, the object must be in this list (not in another list with the same hook), which is checked
+// in debug mode by walking from its hook to the end of this list.
+
+// Functions with the same names as in std::list do the same, but take objects by reference instead of values. In debug
+// mode (NDEBUG is not defined) functions check with assert, that inserted objects are not linked and erased ones are,
+// and CheckStatus checks links of the whole list.
+
+
+#pragma once
+
+#include "list.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+//
+// DECLARATIONS
+//
+
+struct IntrusiveListHook {
+  // Managed by IntrusiveList, must not be changed by user
+  IntrusiveListHook* next = nullptr;
+  IntrusiveListHook* prev = nullptr;
+
+  IntrusiveListHook() noexcept;
+  IntrusiveListHook(const IntrusiveListHook& other) noexcept;
+  IntrusiveListHook& operator=(const IntrusiveListHook& other) noexcept;
+
+  ~IntrusiveListHook() noexcept;
+
+  bool is_linked() const noexcept;
+};
+
+// Member of T, which is linked by IntrusiveList: Hook is the pointer to it and Offset its offset in T
+template <typename T, IntrusiveListHook T::*Hook, size_t Offset>
+struct IntrusiveListMember {
+  static_assert(std::is_standard_layout_v<T>, "IntrusiveList needs a standard-layout type T to find it by its hook");
+
+  using value_type = T;
+  static constexpr size_t kOffset = Offset;
+
+  static IntrusiveListHook& HookOf(T& object) noexcept;
+};
+
+#define INTRUSIVE_LIST_MEMBER(T, hook) IntrusiveListMember<T, &T::hook, offsetof(T, hook)>
+
+template <typename T, typename Member>
+class IntrusiveList {
+  static_assert(std::is_same_v<typename Member::value_type, T>, "Member must be a hook of T");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  IntrusiveList() noexcept;
+  IntrusiveList(const IntrusiveList& other) = delete;
+  IntrusiveList(IntrusiveList&& other) noexcept;
+
+  ~IntrusiveList() noexcept;
+
+  IntrusiveList& operator=(const IntrusiveList& other) = delete;
+  IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+
+  size_t size() const noexcept;
+  bool empty() const noexcept;
+
+  const T& front() const noexcept;
+  const T& back() const noexcept;
+
+  T& front() noexcept;
+  T& back() noexcept;
+
+  void clear() noexcept;
+
+  void push_back(T& object) noexcept;
+  void push_front(T& object) noexcept;
+
+  void pop_front() noexcept;
+  void pop_back() noexcept;
+
+  void CheckStatus() const;
+
+ private:
+  template <bool IsConst>
+  using UnitedIterator = RingIterator<T, IntrusiveListHook, IntrusiveList, IsConst>;
+
+  template <typename, typename, typename, bool>
+  friend class RingIterator;
+
+  void MoveFromOther(IntrusiveList&& other) noexcept;
+  void LinkBefore(IntrusiveListHook* pos, IntrusiveListHook* hook) noexcept;
+  void Unlink(IntrusiveListHook* hook) noexcept;
+  bool Owns(const IntrusiveListHook* hook) const noexcept;
+
+  static IntrusiveListHook* HookOf(T& object) noexcept;
+  static T* ValueOf(IntrusiveListHook* hook) noexcept;
+
+  IntrusiveListHook end_;
+  size_t length_ = 0;
+
+ public:
+  using const_iterator = UnitedIterator<true>;
+  using iterator = UnitedIterator<false>;
+  using reverse_iterator = std::reverse_iterator<UnitedIterator<false>>;
+  using const_reverse_iterator = std::reverse_iterator<UnitedIterator<true>>;
+  using difference_type = std::ptrdiff_t;
+
+  iterator begin() noexcept;
+  iterator end() noexcept;
+
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  reverse_iterator rbegin() noexcept;
+  reverse_iterator rend() noexcept;
+
+  const_reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator rend() const noexcept;
+
+  const_reverse_iterator crbegin() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+
+  iterator iterator_to(T& object) noexcept;
+  const_iterator iterator_to(const T& object) const noexcept;
+
+  template <bool IsConst>
+  UnitedIterator<IsConst> insert(UnitedIterator<IsConst> pos, T& object) noexcept;
+
+  template <bool IsConst>
+  UnitedIterator<IsConst> erase(UnitedIterator<IsConst> pos) noexcept;
+  iterator erase(T& object) noexcept;
+
+  template <bool IsConst>
+  void splice(UnitedIterator<IsConst> pos, IntrusiveList& other) noexcept;
+  template <bool IsConst, bool IsConstOther>
+  void splice(UnitedIterator<IsConst> pos, IntrusiveList& other, UnitedIterator<IsConstOther> it) noexcept;
+};
+
+#include "intrusive_list.ipp"
@@ -0,0 +1,500 @@
+//
+// This is a .ipp file for intrusive_list.hpp. For more information check intrusive_list.hpp.
+//
+
+//
+// INTRUSIVE LIST HOOK
+//
+
+/**
+ * Constructs hook, which is not linked.
+ */
+inline IntrusiveListHook::IntrusiveListHook() noexcept {}
+
+/**
+ * Constructs hook, which is not linked. Links of other are not copied.
+ */
+inline IntrusiveListHook::IntrusiveListHook(const IntrusiveListHook&) noexcept {}
+
+/**
+ * Does nothing: hook keeps its own links, links of other are not copied.
+ */
+inline IntrusiveListHook& IntrusiveListHook::operator=(const IntrusiveListHook&) noexcept {
+  return *this;
+}
+
+/**
+ * In debug mode checks that hook is not linked, so that no list keeps a dangling pointer to it.
+ */
+inline IntrusiveListHook::~IntrusiveListHook() noexcept {
+  assert(!is_linked());
+}
+
+/**
+ * Returns true if hook is in a list (or is the sentinel of a list).
+ */
+inline bool IntrusiveListHook::is_linked() const noexcept {
+  return next != nullptr;
+}
+
+//
+// INTRUSIVE LIST MEMBER
+//
+
+/**
+ * Returns hook of object, which is linked by lists with this Member.
+ */
+template <typename T, IntrusiveListHook T::*Hook, size_t Offset>
+IntrusiveListHook& IntrusiveListMember<T, Hook, Offset>::HookOf(T& object) noexcept {
+  return object.*Hook;
+}
+
+//
+// INTRUSIVE LIST CONSTRUCTORS
+//
+
+/**
+ * Constructs empty list.
+ */
+template <typename T, typename Member>
+IntrusiveList<T, Member>::IntrusiveList() noexcept {
+  end_.next = &end_;
+  end_.prev = &end_;
+}
+
+/**
+ * Takes all objects of other, other becomes empty.
+ */
+template <typename T, typename Member>
+IntrusiveList<T, Member>::IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList() {
+  MoveFromOther(std::move(other));
+}
+
+//
+// INTRUSIVE LIST DESTRUCTOR
+//
+
+/**
+ * Unlinks all objects, they are not destroyed.
+ */
+template <typename T, typename Member>
+IntrusiveList<T, Member>::~IntrusiveList() noexcept {
+  clear();
+  end_.next = nullptr;
+  end_.prev = nullptr;
+}
+
+//
+// INTRUSIVE LIST ASSIGNMENT OPERATORS
+//
+
+/**
+ * Unlinks own objects and takes all objects of other, other becomes empty.
+ */
+template <typename T, typename Member>
+IntrusiveList<T, Member>& IntrusiveList<T, Member>::operator=(IntrusiveList&& other) noexcept {
+  if (&other == this) {
+    return *this;
+  }
+  clear();
+  MoveFromOther(std::move(other));
+
+  return *this;
+}
+
+//
+// INTRUSIVE LIST FUNCTIONS
+//
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+size_t IntrusiveList<T, Member>::size() const noexcept {
+  return length_;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+bool IntrusiveList<T, Member>::empty() const noexcept {
+  return length_ == 0;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+const T& IntrusiveList<T, Member>::front() const noexcept {
+  return *ValueOf(end_.next);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+const T& IntrusiveList<T, Member>::back() const noexcept {
+  return *ValueOf(end_.prev);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+T& IntrusiveList<T, Member>::front() noexcept {
+  return *ValueOf(end_.next);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+T& IntrusiveList<T, Member>::back() noexcept {
+  return *ValueOf(end_.prev);
+}
+
+/**
+ * Unlinks all objects, they are not destroyed. Takes time linear in size, because links of every hook are reset.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::clear() noexcept {
+  IntrusiveListHook* current_node = end_.next;
+  while (current_node != &end_) {
+    IntrusiveListHook* next_node = current_node->next;
+    current_node->next = nullptr;
+    current_node->prev = nullptr;
+    current_node = next_node;
+  }
+  end_.next = &end_;
+  end_.prev = &end_;
+  length_ = 0;
+}
+
+/**
+ * Links object to the back of list. Object must not be linked by its hook.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::push_back(T& object) noexcept {
+  LinkBefore(&end_, HookOf(object));
+}
+
+/**
+ * Links object to the front of list. Object must not be linked by its hook.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::push_front(T& object) noexcept {
+  LinkBefore(end_.next, HookOf(object));
+}
+
+/**
+ * Unlinks the front object. List must not be empty.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::pop_front() noexcept {
+  Unlink(end_.next);
+}
+
+/**
+ * Unlinks the back object. List must not be empty.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::pop_back() noexcept {
+  Unlink(end_.prev);
+}
+
+/**
+ * Checks if list is not "broken". Does nothing if NDEBUG is defined.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::CheckStatus() const {
+  CheckRing(&end_, length_);
+}
+
+/**
+ * Returns iterator to object, which must be in this list. Takes constant time.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::iterator IntrusiveList<T, Member>::iterator_to(T& object) noexcept {
+  assert(Member::HookOf(object).is_linked());
+  return iterator(HookOf(object));
+}
+
+/**
+ * Returns iterator to object, which must be in this list. Takes constant time.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_iterator IntrusiveList<T, Member>::iterator_to(
+    const T& object) const noexcept {
+  T& mutable_object = const_cast<T&>(object);
+  assert(Member::HookOf(mutable_object).is_linked());
+  return const_iterator(HookOf(mutable_object));
+}
+
+/**
+ * Links object before pos. Object must not be linked by its hook. Returns iterator to object.
+ */
+template <typename T, typename Member>
+template <bool IsConst>
+typename IntrusiveList<T, Member>::template UnitedIterator<IsConst> IntrusiveList<T, Member>::insert(
+    UnitedIterator<IsConst> pos,
+    T& object) noexcept {
+  IntrusiveListHook* hook = HookOf(object);
+  LinkBefore(pos.current_node_, hook);
+  return UnitedIterator<IsConst>(hook);
+}
+
+/**
+ * Unlinks object at pos. Returns iterator to the object after it.
+ */
+template <typename T, typename Member>
+template <bool IsConst>
+typename IntrusiveList<T, Member>::template UnitedIterator<IsConst> IntrusiveList<T, Member>::erase(
+    UnitedIterator<IsConst> pos) noexcept {
+  IntrusiveListHook* next_node = pos.current_node_->next;
+  Unlink(pos.current_node_);
+  return UnitedIterator<IsConst>(next_node);
+}
+
+/**
+ * Unlinks object in constant time. Object must be in this list. Returns iterator to the object after it.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::iterator IntrusiveList<T, Member>::erase(T& object) noexcept {
+  return erase(iterator_to(object));
+}
+
+/**
+ * Moves all objects of other before pos in constant time.
+ */
+template <typename T, typename Member>
+template <bool IsConst>
+void IntrusiveList<T, Member>::splice(UnitedIterator<IsConst> pos, IntrusiveList& other) noexcept {
+  if (&other == this || other.empty()) {
+    return;
+  }
+
+  IntrusiveListHook* first = other.end_.next;
+  IntrusiveListHook* last = other.end_.prev;
+  other.end_.next = &other.end_;
+  other.end_.prev = &other.end_;
+
+  first->prev = pos.current_node_->prev;
+  last->next = pos.current_node_;
+  pos.current_node_->prev->next = first;
+  pos.current_node_->prev = last;
+
+  length_ += other.length_;
+  other.length_ = 0;
+}
+
+/**
+ * Moves object at it from other before pos in constant time.
+ */
+template <typename T, typename Member>
+template <bool IsConst, bool IsConstOther>
+void IntrusiveList<T, Member>::splice(UnitedIterator<IsConst> pos,
+                                    IntrusiveList& other,
+                                    UnitedIterator<IsConstOther> it) noexcept {
+  IntrusiveListHook* node = it.current_node_;
+  if (pos.current_node_ == node || pos.current_node_ == node->next) {
+    return;
+  }
+
+  other.Unlink(node);
+  LinkBefore(pos.current_node_, node);
+}
+
+/**
+ * Takes all objects of other, this must be empty.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::MoveFromOther(IntrusiveList&& other) noexcept {
+  if (other.empty()) {
+    return;
+  }
+
+  end_.next = other.end_.next;
+  end_.prev = other.end_.prev;
+  end_.next->prev = &end_;
+  end_.prev->next = &end_;
+  length_ = other.length_;
+
+  other.end_.next = &other.end_;
+  other.end_.prev = &other.end_;
+  other.length_ = 0;
+}
+
+/**
+ * Links hook before pos. In debug mode checks that hook is not linked and pos is.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::LinkBefore(IntrusiveListHook* pos, IntrusiveListHook* hook) noexcept {
+  assert(!hook->is_linked());
+  assert(pos->prev->next == pos);
+
+  hook->next = pos;
+  hook->prev = pos->prev;
+  pos->prev->next = hook;
+  pos->prev = hook;
+  ++length_;
+}
+
+/**
+ * Unlinks hook and resets its links. In debug mode checks that hook is linked to its neighbours and is in this list.
+ */
+template <typename T, typename Member>
+void IntrusiveList<T, Member>::Unlink(IntrusiveListHook* hook) noexcept {
+  assert(hook != &end_);
+  assert(hook->is_linked());
+  assert(Owns(hook));
+  assert(hook->prev->next == hook && hook->next->prev == hook);
+  assert(length_ > 0);
+
+  hook->prev->next = hook->next;
+  hook->next->prev = hook->prev;
+  hook->next = nullptr;
+  hook->prev = nullptr;
+  --length_;
+}
+
+/**
+ * Returns true if linked hook is in this list, false if it is in another one. Walks from hook to end_, so it takes time
+ * linear in size and is only called in debug mode.
+ */
+template <typename T, typename Member>
+bool IntrusiveList<T, Member>::Owns(const IntrusiveListHook* hook) const noexcept {
+  for (const IntrusiveListHook* node = hook->next; node != hook; node = node->next) {
+    if (node == &end_) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Returns hook of object. In debug mode checks that ValueOf finds object by it, so that offset of Member is the one of
+ * its hook.
+ */
+template <typename T, typename Member>
+IntrusiveListHook* IntrusiveList<T, Member>::HookOf(T& object) noexcept {
+  IntrusiveListHook* hook = &Member::HookOf(object);
+  assert(ValueOf(hook) == &object);
+  return hook;
+}
+
+/**
+ * Returns object, which contains hook as its member. Used by iterators. The hook is a member of standard-layout T at
+ * offset Member::kOffset, given by offsetof. Stepping back from a member to its object by a char pointer (the
+ * container_of idiom) is not sanctioned by the standard, unless the hook is the first member, but GCC, Clang and MSVC
+ * support it, as Boost.Intrusive and the Linux kernel rely on it.
+ */
+template <typename T, typename Member>
+T* IntrusiveList<T, Member>::ValueOf(IntrusiveListHook* hook) noexcept {
+  if constexpr (Member::kOffset == 0) {
+    // first member of a standard-layout object is pointer-interconvertible with it
+    return reinterpret_cast<T*>(hook);
+  } else {
+    return reinterpret_cast<T*>(reinterpret_cast<char*>(hook) - Member::kOffset);
+  }
+}
+
+//
+// INTRUSIVE LIST ITERATORS
+//
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::iterator IntrusiveList<T, Member>::begin() noexcept {
+  return iterator(end_.next);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::iterator IntrusiveList<T, Member>::end() noexcept {
+  return iterator(&end_);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_iterator IntrusiveList<T, Member>::cbegin() const noexcept {
+  return const_iterator(end_.next);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_iterator IntrusiveList<T, Member>::cend() const noexcept {
+  return const_iterator(const_cast<IntrusiveListHook*>(&end_));
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_iterator IntrusiveList<T, Member>::begin() const noexcept {
+  return cbegin();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_iterator IntrusiveList<T, Member>::end() const noexcept {
+  return cend();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::reverse_iterator IntrusiveList<T, Member>::rbegin() noexcept {
+  return reverse_iterator(end());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::reverse_iterator IntrusiveList<T, Member>::rend() noexcept {
+  return reverse_iterator(begin());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_reverse_iterator IntrusiveList<T, Member>::crbegin() const noexcept {
+  return const_reverse_iterator(cend());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_reverse_iterator IntrusiveList<T, Member>::crend() const noexcept {
+  return const_reverse_iterator(cbegin());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_reverse_iterator IntrusiveList<T, Member>::rbegin() const noexcept {
+  return crbegin();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Member>
+typename IntrusiveList<T, Member>::const_reverse_iterator IntrusiveList<T, Member>::rend() const noexcept {
+  return crend();
+}
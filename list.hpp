@@ -8,6 +8,12 @@
 // move-assignable. For some operations, like copying a list, T must be copy-assignable and copy-constructable.
 // Allocator is an allocator type for T. It must meet the named requirements of Allocator and the line
 // std::allocator_traits<Allocator>::rebind_alloc<Node> should compile (class Node is declared beyond in this file).
+// If the node allocator has a member function release(), it is called by clear() after all nodes are deallocated, so
+// that pooling allocators like PoolAllocator (see pool_allocator.hpp) can return their memory. If it has a member
+// function reserve(count), it is called before a known number of nodes is created at once.
+// Instrumentation is a policy, which counts allocations, copies, moves and traversals of list. The default one,
+// NoInstrumentation, costs nothing, CountingInstrumentation counts everything. For more information check
+// list_instrumentation.hpp.
 
 // Public functions in snake_case, constructors and destructor do the same as ones with same signature of std::list.
 // Other functions are documented in list.ipp.
@@ -18,19 +24,35 @@
 // which does not carry a value. All other nodes carry a value, end_.next points to the front node, end_.prev to the
 // back one.
 
+// Iterators of List are RingIterator<T, NodeBase, List, IsConst>, a template shared with IntrusiveList (see
+// intrusive_list.hpp). It walks a ring of nodes with members "next" and "prev" and gets the value of a node by the
+// private static function ValueOf of its owner, so that List and IntrusiveList only differ in that function.
+
 
 #pragma once
 
 #include <memory>
 #include <iostream>
 #include <cmath>
+#include <cassert>
+#include <functional>
+#include <iterator>
+#include <initializer_list>
+
+#include "list_instrumentation.hpp"
 
 //
 // DECLARATIONS
 //
 
-template <typename T, typename Allocator = std::allocator<T>>
-class List {
+template <typename NodeType>
+void CheckRing(const NodeType* end, size_t length);
+
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+class RingIterator;
+
+template <typename T, typename Allocator = std::allocator<T>, typename Instrumentation = NoInstrumentation>
+class List : private Instrumentation {
  public:
   using value_type = T;
   using reference = T&;
@@ -43,11 +65,20 @@ class List {
       && std::is_nothrow_move_constructible_v<NodeAllocator>);
   explicit List(size_t count, const T& value = T(), const Allocator& alloc = Allocator());
   explicit List(const Allocator& alloc);
+  template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+  List(InputIt first, InputIt last, const Allocator& alloc = Allocator());
+  List(std::initializer_list<T> init, const Allocator& alloc = Allocator());
 
   ~List() noexcept;
 
   List& operator=(const List& other);
   List& operator=(List&& other) noexcept(noexcept(MoveFromOther(std::move(other))));
+  List& operator=(std::initializer_list<T> init);
+
+  template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+  void assign(InputIt first, InputIt last);
+  void assign(size_t count, const T& value);
+  void assign(std::initializer_list<T> init);
 
   size_t size() const noexcept;
 
@@ -74,34 +105,100 @@ class List {
   void pop_front() noexcept;
   void pop_back() noexcept;
 
+  void resize(size_t count);
+  void resize(size_t count, const T& value);
+
   void reverse();
   void unique();
 
+  void merge(List& other);
+  void merge(List&& other);
+  template <typename Compare>
+  void merge(List& other, Compare comp);
+  template <typename Compare>
+  void merge(List&& other, Compare comp);
+
+  void sort();
+  template <typename Compare>
+  void sort(Compare comp);
+
   void Print() const;
+  void CheckStatus();
+
+  typename Instrumentation::Stats GetStats() const noexcept;
+  void DumpStats(std::ostream& out = std::cout) const;
 
  private:
+  struct Node;
+  struct NodeBase;
+
   // To avoid copy-pasting code for const and not const versions, iterator is template class
   template <bool IsConst>
-  class UnitedIterator;
+  using UnitedIterator = RingIterator<T, NodeBase, List, IsConst>;
 
-  struct Node;
-  struct NodeBase;
+  template <typename, typename, typename, bool>
+  friend class RingIterator;
 
   void CopyFromOther(const List& other);
   void MoveFromOther(List&& other) noexcept(std::is_nothrow_move_assignable_v<NodeAllocator>);
   template <typename... Args_t>
   void InsertToEmpty(Args_t&& ...args);
-  void CopyPartOfCommonSize(NodeBase*& this_pointer, NodeBase*& other_pointer, const List<T, Allocator>& other);
-  void CopyNewNodes(NodeBase*& this_pointer, NodeBase*& other_pointer, const List<T, Allocator>& other);
-  void DeleteRedundantNodes(NodeBase*& this_pointer, size_t count);
+  template <typename InputIt>
+  void AssignRange(InputIt first, InputIt last);
+  template <typename... Args_t>
+  void ResizeWith(size_t count, const Args_t& ...args);
+  void DestroyAllNodes() noexcept;
+  void ReleaseNodeMemory() noexcept;
+  template <typename... Args_t>
+  Node* CreateNode(Args_t&& ...args);
+  void DestroyNode(NodeBase* node) noexcept;
+  template <typename... Args_t>
+  NodeBase* CreateChain(size_t count, NodeBase*& chain_last, const Args_t& ...args);
+  template <typename InputIt>
+  NodeBase* CreateChainFromRange(InputIt first, InputIt last, NodeBase*& chain_last, size_t& count);
+  size_t DestroyChain(NodeBase* first, NodeBase* stop) noexcept;
+  void EraseToEnd(NodeBase* first) noexcept;
+  void ReserveNodes(size_t count);
+  void LinkChainBefore(NodeBase* pos, NodeBase* chain_first, NodeBase* chain_last, size_t count) noexcept;
+  NodeBase* NodeAt(size_t index) const noexcept;
+
+  static void LinkBefore(NodeBase* pos, NodeBase* first, NodeBase* last) noexcept;
+  static void Unlink(NodeBase* first, NodeBase* last) noexcept;
+  template <typename Compare>
+  static void MergeChains(NodeBase*& left, NodeBase* right, Compare& comp);
 
   static Node* AsNode(NodeBase* node_base);
+  static T* ValueOf(NodeBase* node_base);
 
-  void CheckStatus();
 
   using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
   using NodeAllocatorTraits = std::allocator_traits<NodeAllocator>;
 
+  template <typename AllocatorType, typename = void>
+  struct HasReserve : std::false_type {};
+  template <typename AllocatorType>
+  struct HasReserve<AllocatorType, std::void_t<decltype(std::declval<AllocatorType&>().reserve(size_t()))>>
+      : std::true_type {};
+
+  template <typename AllocatorType, typename = void>
+  struct HasRelease : std::false_type {};
+  template <typename AllocatorType>
+  struct HasRelease<AllocatorType, std::void_t<decltype(std::declval<AllocatorType&>().release())>>
+      : std::true_type {};
+
+  // Classify arguments of CreateNode, deduced as forwarding references: a single non-const rvalue of T is moved, a
+  // single other T is copied, anything else is emplaced
+  template <typename... Args_t>
+  struct IsMove : std::false_type {};
+  template <typename Arg_t>
+  struct IsMove<Arg_t> : std::is_same<Arg_t, T> {};
+  template <typename... Args_t>
+  struct IsCopy : std::false_type {};
+  template <typename Arg_t>
+  struct IsCopy<Arg_t>
+      : std::bool_constant<std::is_same_v<std::remove_cv_t<std::remove_reference_t<Arg_t>>, T>
+                               && !IsMove<Arg_t>::value> {};
+
   NodeBase end_;
   NodeAllocator alloc_;
   size_t length_ = 0;
@@ -111,7 +208,7 @@ class List {
   using iterator = UnitedIterator<false>;
   using reverse_iterator = std::reverse_iterator<UnitedIterator<false>>;
   using const_reverse_iterator = std::reverse_iterator<UnitedIterator<true>>;
-  using difference_type = typename iterator::difference_type;
+  using difference_type = std::ptrdiff_t;
 
   iterator begin();
   iterator end();
@@ -145,35 +242,64 @@ class List {
 
   template <bool IsConst>
   UnitedIterator<IsConst> insert(List::UnitedIterator<IsConst> pos, T&& value);
+
+  template <bool IsConst>
+  UnitedIterator<IsConst> insert(List::UnitedIterator<IsConst> pos, size_t count, const T& value);
+
+  template <bool IsConst,
+            typename InputIt,
+            typename = typename std::iterator_traits<InputIt>::iterator_category>
+  UnitedIterator<IsConst> insert(List::UnitedIterator<IsConst> pos, InputIt first, InputIt last);
+
+  template <bool IsConst>
+  UnitedIterator<IsConst> insert(List::UnitedIterator<IsConst> pos, std::initializer_list<T> init);
+
+  template <bool IsConst>
+  void splice(UnitedIterator<IsConst> pos, List& other);
+  template <bool IsConst>
+  void splice(UnitedIterator<IsConst> pos, List&& other);
+  template <bool IsConst, bool IsConstOther>
+  void splice(UnitedIterator<IsConst> pos, List& other, UnitedIterator<IsConstOther> it);
+  template <bool IsConst, bool IsConstOther>
+  void splice(UnitedIterator<IsConst> pos, List&& other, UnitedIterator<IsConstOther> it);
+  template <bool IsConst, bool IsConstFirst, bool IsConstLast>
+  void splice(UnitedIterator<IsConst> pos,
+              List& other,
+              UnitedIterator<IsConstFirst> first,
+              UnitedIterator<IsConstLast> last);
+  template <bool IsConst, bool IsConstFirst, bool IsConstLast>
+  void splice(UnitedIterator<IsConst> pos,
+              List&& other,
+              UnitedIterator<IsConstFirst> first,
+              UnitedIterator<IsConstLast> last);
 };
 
-template <typename T, typename Allocator>
-struct List<T, Allocator>::NodeBase {
+template <typename T, typename Allocator, typename Instrumentation>
+struct List<T, Allocator, Instrumentation>::NodeBase {
   NodeBase* next = this;
   NodeBase* prev = this;
 
   NodeBase();
 };
 
-template <typename T, typename Allocator>
-struct List<T, Allocator>::Node : public NodeBase {
+template <typename T, typename Allocator, typename Instrumentation>
+struct List<T, Allocator, Instrumentation>::Node : public NodeBase {
   T value;
 
   template <typename... Args_t>
   explicit Node(Args_t&& ...args);
 };
 
-template <typename T, typename Allocator>
-template <bool IsConst>
-class List<T, Allocator>::UnitedIterator {
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+class RingIterator {
  public:
-  explicit UnitedIterator(NodeBase* node);
+  explicit RingIterator(NodeType* node);
 
-  UnitedIterator operator++(int);
-  UnitedIterator operator--(int);
+  RingIterator operator++(int);
+  RingIterator operator--(int);
 
-  UnitedIterator& operator++();
-  UnitedIterator& operator--();
+  RingIterator& operator++();
+  RingIterator& operator--();
 
   using pointer = std::conditional_t<IsConst, const T*, T*>;
   using reference = std::conditional_t<IsConst, const T&, T&>;
@@ -185,14 +311,16 @@ class List<T, Allocator>::UnitedIterator {
   pointer operator->() const;
 
   template <bool IsConstOther>
-  bool operator==(const UnitedIterator<IsConstOther>& other);
+  bool operator==(const RingIterator<T, NodeType, Owner, IsConstOther>& other) const;
   template <bool IsConstOther>
-  bool operator!=(const UnitedIterator<IsConstOther>& other);
+  bool operator!=(const RingIterator<T, NodeType, Owner, IsConstOther>& other) const;
 
  private:
-  NodeBase* current_node_;
+  NodeType* current_node_;
 
-  friend class List<T>;
+  template <typename, typename, typename, bool>
+  friend class RingIterator;
+  friend Owner;
 };
 
 #include "list.ipp"
@@ -12,47 +12,48 @@
  * Default constructor
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>::NodeBase::NodeBase() {}
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::NodeBase::NodeBase() {}
 
 /**
  * Constructor, that constructs value in node from args.
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <typename... Args_t>
-List<T, Allocator>::Node::Node(Args_t&& ...args) : value(std::forward<Args_t>(args)...) {
+List<T, Allocator, Instrumentation>::Node::Node(Args_t&& ...args) : value(std::forward<Args_t>(args)...) {
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>::List() : alloc_(NodeAllocator()) {}
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::List() : alloc_(NodeAllocator()) {}
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>::List(size_t count, const T& value, const Allocator& alloc) : alloc_(NodeAllocator(alloc)) {
-  for (size_t i = 0; i < count; ++i) {
-    push_back(value);
-  }
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::List(size_t count, const T& value, const Allocator& alloc)
+    : alloc_(NodeAllocator(alloc)) {
+  NodeBase* chain_last = nullptr;
+  NodeBase* chain_first = CreateChain(count, chain_last, value);
+  LinkChainBefore(&end_, chain_first, chain_last, count);
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>::List(const List& other) : alloc_(other.alloc_) {
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::List(const List& other) : alloc_(other.alloc_) {
   CopyFromOther(other);
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>::List(List&& other) noexcept(noexcept(MoveFromOther(std::move(other)))
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::List(List&& other) noexcept(noexcept(MoveFromOther(std::move(other)))
     && std::is_nothrow_move_constructible_v<NodeAllocator>) : alloc_(std::move(other.alloc_)) {
   MoveFromOther(std::move(other));
 }
@@ -60,8 +61,27 @@ List<T, Allocator>::List(List&& other) noexcept(noexcept(MoveFromOther(std::move
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>::List(const Allocator& alloc) : alloc_(NodeAllocator(alloc)) {}
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::List(const Allocator& alloc) : alloc_(NodeAllocator(alloc)) {}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename InputIt, typename>
+List<T, Allocator, Instrumentation>::List(InputIt first, InputIt last, const Allocator& alloc)
+    : alloc_(NodeAllocator(alloc)) {
+  AssignRange(first, last);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::List(std::initializer_list<T> init, const Allocator& alloc)
+    : alloc_(NodeAllocator(alloc)) {
+  AssignRange(init.begin(), init.end());
+}
 
 //
 // LIST ASSIGNMENT OPERATORS
@@ -70,8 +90,8 @@ List<T, Allocator>::List(const Allocator& alloc) : alloc_(NodeAllocator(alloc))
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>& List<T, Allocator>::operator=(const List& other) {
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>& List<T, Allocator, Instrumentation>::operator=(const List& other) {
   if (&other == this) {
     return *this;
   }
@@ -83,8 +103,9 @@ List<T, Allocator>& List<T, Allocator>::operator=(const List& other) {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>& List<T, Allocator>::operator=(List&& other) noexcept(noexcept(MoveFromOther(std::move(other)))) {
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>& List<T, Allocator, Instrumentation>::operator=(List&& other) noexcept(noexcept(
+    MoveFromOther(std::move(other)))) {
   if (&other == this) {
     return *this;
   }
@@ -93,6 +114,16 @@ List<T, Allocator>& List<T, Allocator>::operator=(List&& other) noexcept(noexcep
   return *this;
 }
 
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>& List<T, Allocator, Instrumentation>::operator=(std::initializer_list<T> init) {
+  AssignRange(init.begin(), init.end());
+
+  return *this;
+}
+
 //
 // LIST DESTRUCTOR
 //
@@ -100,8 +131,8 @@ List<T, Allocator>& List<T, Allocator>::operator=(List&& other) noexcept(noexcep
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-List<T, Allocator>::~List() noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+List<T, Allocator, Instrumentation>::~List() noexcept {
   clear();
 }
 
@@ -112,108 +143,66 @@ List<T, Allocator>::~List() noexcept {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::push_back(const T& value) {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::push_back(const T& value) {
   emplace_back(value);
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::push_back(T&& value) {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::push_back(T&& value) {
   emplace_back(std::move(value));
 }
 
 /**
  * Makes this a copy of other. May throw exceptions, for example, when allocating memory. Values of type T are copied
- * here.
+ * here. Nodes of this are reused: values are copy-assigned to them, only missing nodes are created and only redundant
+ * ones are destroyed.
  *
  * @tparam T Type of elements in container
  * @tparam Allocator Allocator type
  * @param other List to be copied from
 */
-template <typename T, typename Allocator>
-void List<T, Allocator>::CopyFromOther(const List<T, Allocator>& other) {
-  NodeBase* other_pointer = other.end_.prev;
-  NodeBase* this_pointer = end_.prev;
-
-  CopyPartOfCommonSize(this_pointer, other_pointer, other);
-
-  if (other.length_ >= length_) {
-    CopyNewNodes(this_pointer, other_pointer, other);
-  } else {
-    end_.next = this_pointer;
-    DeleteRedundantNodes(this_pointer, length_ - other.length_);
-  }
-
-  length_ = other.length_;
-}
-
-/**
- * Copies part of other list to this. Starts from the end of other, copies min(other.length_, length_) elements.
- * Changes this_pointer and other_pointer, at the end they point at the last copied nodes.
- *
- * @tparam T Type of elements in container
- * @tparam Allocator Allocator type
- * @param this_pointer Pointer to position in this class
- * @param other_pointer Pointer to position in other class
- * @param other List to be copied from
- */
-template <typename T, typename Allocator>
-void List<T, Allocator>::CopyPartOfCommonSize(NodeBase*& this_pointer,
-                                              NodeBase*& other_pointer,
-                                              const List<T, Allocator>& other) {
-  for (size_t i = 0; i < std::min(other.length_, length_); ++i) {
-    AsNode(this_pointer)->value = AsNode(other_pointer)->value;
-
-    other_pointer = other_pointer->prev;
-    this_pointer = this_pointer->prev;
-  }
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::CopyFromOther(const List& other) {
+  AssignRange(other.begin(), other.end());
+  this->OnTraversal(ListOperation::kCopy, length_);
 }
 
 /**
- * Creates other.length - length nodes, which are copies of first other.length - length nodes of other.
- * Initially this_pointer and other_pointer must be pointers to nodes, where to start copying. At the end they point
- * to last copied nodes.
+ * Makes this contain values in [first, last). Values are assigned to existing nodes in order (moved if *first is an
+ * rvalue, copied otherwise), then either redundant nodes are erased, or the rest of values is appended as one chain.
+ * If an exception is thrown, list is valid, but may contain only a part of new values.
  *
- * @tparam T Type of elements in container
- * @tparam Allocator Allocator type
- * @param this_pointer Pointer to position in this class
- * @param other_pointer Pointer to position in other class
- * @param other List to be copied from
+ * @tparam InputIt Type of input iterator, *first must be convertible to T
+ * @param first Iterator to the first value
+ * @param last Iterator after the last value
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::CopyNewNodes(NodeBase*& this_pointer,
-                                      NodeBase*& other_pointer,
-                                      const List<T, Allocator>& other) {
-  size_t old_this_length = length_;
-  for (size_t i = 0; i < other.length_ - old_this_length; ++i) {
-    push_front(AsNode(other_pointer)->value);
-
-    other_pointer = other_pointer->prev;
-    this_pointer = this_pointer->prev;
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename InputIt>
+void List<T, Allocator, Instrumentation>::AssignRange(InputIt first, InputIt last) {
+  // move iterators and iterators returning values by value give rvalues, which are move-assigned
+  constexpr bool kIsRvalue = !std::is_lvalue_reference_v<decltype(*first)>;
+  NodeBase* current_node = end_.next;
+  for (; current_node != &end_ && first != last; ++first) {
+    AsNode(current_node)->value = *first;
+    if constexpr (kIsRvalue) {
+      this->OnValueMoved();
+    } else {
+      this->OnValueCopied();
+    }
+    current_node = current_node->next;
   }
-}
 
-/**
- * Deletes count nodes, starting from this_pointer->prev and going to the "prev" side.
- *
- * @tparam T Type of elements in container
- * @tparam Allocator Allocator type
- * @param this_pointer Pointer to position in this class
- * @param count Number of elements to be deleted
- */
-template <typename T, typename Allocator>
-void List<T, Allocator>::DeleteRedundantNodes(NodeBase*& this_pointer, size_t count) {
-  this_pointer = this_pointer->prev;
-  for (size_t i = 0; i < count; ++i) {
-    NodeBase* this_pointer_prev = this_pointer->prev;
-
-    NodeAllocatorTraits::destroy(alloc_, AsNode(this_pointer));
-    NodeAllocatorTraits::deallocate(alloc_, AsNode(this_pointer), 1);
-
-    this_pointer = this_pointer_prev;
+  if (current_node != &end_) {
+    EraseToEnd(current_node);
+  } else {
+    size_t count = 0;
+    NodeBase* chain_last = nullptr;
+    NodeBase* chain_first = CreateChainFromRange(first, last, chain_last, count);
+    LinkChainBefore(&end_, chain_first, chain_last, count);
   }
 }
 
@@ -225,8 +214,9 @@ void List<T, Allocator>::DeleteRedundantNodes(NodeBase*& this_pointer, size_t co
  * @tparam Allocator Allocator type
  * @param other List to be moved from
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::MoveFromOther(List&& other) noexcept(std::is_nothrow_move_assignable_v<NodeAllocator>) {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::MoveFromOther(List&& other) noexcept(
+    std::is_nothrow_move_assignable_v<NodeAllocator>) {
   if (&other == this) {
     return;
   }
@@ -240,6 +230,8 @@ void List<T, Allocator>::MoveFromOther(List&& other) noexcept(std::is_nothrow_mo
     other.end_.prev->next = &end_;
     end_ = other.end_;
     length_ = other.length_;
+    this->OnNodesReceived(length_);
+    other.OnNodesGivenAway(length_);
 
     other.end_.next = &other.end_;
     other.end_.prev = &other.end_;
@@ -250,80 +242,359 @@ void List<T, Allocator>::MoveFromOther(List&& other) noexcept(std::is_nothrow_mo
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-bool List<T, Allocator>::empty() const noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+bool List<T, Allocator, Instrumentation>::empty() const noexcept {
   return length_ == 0;
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-size_t List<T, Allocator>::size() const noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+size_t List<T, Allocator, Instrumentation>::size() const noexcept {
   return length_;
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-const T& List<T, Allocator>::front() const noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+const T& List<T, Allocator, Instrumentation>::front() const noexcept {
   return AsNode(end_.next)->value;
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-const T& List<T, Allocator>::back() const noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+const T& List<T, Allocator, Instrumentation>::back() const noexcept {
   return AsNode(end_.prev)->value;
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-T& List<T, Allocator>::front() noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+T& List<T, Allocator, Instrumentation>::front() noexcept {
   return AsNode(end_.next)->value;
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-T& List<T, Allocator>::back() noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+T& List<T, Allocator, Instrumentation>::back() noexcept {
   return AsNode(end_.prev)->value;
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::clear() noexcept {
-  Node* current_node = AsNode(end_.next);
-  Node* next_node = current_node;
-  for (int i = 0; i < length_; ++i) {
-    next_node = AsNode(current_node->next);
-    NodeAllocatorTraits::destroy(alloc_, current_node);
-    NodeAllocatorTraits::deallocate(alloc_, current_node, 1);
-    current_node = next_node;
-  }
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::clear() noexcept {
+  this->OnTraversal(ListOperation::kClear, length_);
+  DestroyAllNodes();
+  ReleaseNodeMemory();
+}
+
+/**
+ * Destroys and deallocates all nodes, leaving list empty. Unlike clear(), does not let allocator release its memory,
+ * so that it can be reused by the following insertions.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::DestroyAllNodes() noexcept {
+  DestroyChain(end_.next, &end_);
   end_.prev = &end_;
   end_.next = &end_;
   length_ = 0;
 }
 
+/**
+ * Calls release() of node allocator if it has one, does nothing otherwise.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::ReleaseNodeMemory() noexcept {
+  if constexpr (HasRelease<NodeAllocator>::value) {
+    alloc_.release();
+  }
+}
+
+/**
+ * Allocates node and constructs it from args. Node is not linked to list. If constructor of value throws, node is
+ * deallocated and exception is rethrown.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename... Args_t>
+typename List<T, Allocator, Instrumentation>::Node* List<T, Allocator, Instrumentation>::CreateNode(Args_t&& ...args) {
+  Node* node = NodeAllocatorTraits::allocate(alloc_, 1);
+  try {
+    NodeAllocatorTraits::construct(alloc_, node, std::forward<Args_t>(args)...);
+  } catch (...) {
+    NodeAllocatorTraits::deallocate(alloc_, node, 1);
+    throw;
+  }
+
+  this->OnNodeAllocated(sizeof(Node));
+  if constexpr (IsMove<Args_t...>::value) {
+    this->OnValueMoved();
+  } else if constexpr (IsCopy<Args_t...>::value) {
+    this->OnValueCopied();
+  } else {
+    this->OnValueEmplaced();
+  }
+  return node;
+}
+
+/**
+ * Destroys value of node and deallocates it. Node must be already unlinked or not used by list any more.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::DestroyNode(NodeBase* node) noexcept {
+  NodeAllocatorTraits::destroy(alloc_, AsNode(node));
+  NodeAllocatorTraits::deallocate(alloc_, AsNode(node), 1);
+  this->OnNodeDeallocated(sizeof(Node));
+}
+
+/**
+ * Creates count nodes from args and links them through "next" and "prev" into a chain, which is not linked to list.
+ * Every node is constructed from the same args, so they are not forwarded. If an exception is thrown, already created
+ * nodes are destroyed.
+ *
+ * @param count Number of nodes
+ * @param chain_last Set to the last node of chain, unchanged if count is 0
+ * @param args Arguments for constructor of T
+ * @return The first node of chain, nullptr if count is 0
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename... Args_t>
+typename List<T, Allocator, Instrumentation>::NodeBase* List<T, Allocator, Instrumentation>::CreateChain(
+    size_t count,
+    NodeBase*& chain_last,
+    const Args_t& ...args) {
+  if (count == 0) {
+    return nullptr;
+  }
+  ReserveNodes(count);
+
+  NodeBase head;
+  NodeBase* tail = &head;
+  try {
+    for (size_t i = 0; i < count; ++i) {
+      Node* node = CreateNode(args...);
+      tail->next = node;
+      node->prev = tail;
+      tail = node;
+    }
+  } catch (...) {
+    tail->next = nullptr;
+    DestroyChain(head.next, nullptr);
+    throw;
+  }
+
+  chain_last = tail;
+  return head.next;
+}
+
+/**
+ * Same as CreateChain, but nodes are constructed from values in [first, last). If InputIt is a forward iterator, the
+ * number of nodes is known in advance and is passed to ReserveNodes.
+ *
+ * @param first Iterator to the first value
+ * @param last Iterator after the last value
+ * @param chain_last Set to the last node of chain, unchanged if range is empty
+ * @param count Set to the number of created nodes
+ * @return The first node of chain, nullptr if range is empty
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename InputIt>
+typename List<T, Allocator, Instrumentation>::NodeBase* List<T, Allocator, Instrumentation>::CreateChainFromRange(
+    InputIt first,
+    InputIt last,
+    NodeBase*& chain_last,
+    size_t& count) {
+  using Category = typename std::iterator_traits<InputIt>::iterator_category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+    ReserveNodes(static_cast<size_t>(std::distance(first, last)));
+  }
+
+  count = 0;
+  NodeBase head;
+  NodeBase* tail = &head;
+  try {
+    for (; first != last; ++first, ++count) {
+      Node* node = CreateNode(*first);
+      tail->next = node;
+      node->prev = tail;
+      tail = node;
+    }
+  } catch (...) {
+    tail->next = nullptr;
+    DestroyChain(head.next, nullptr);
+    throw;
+  }
+
+  if (count == 0) {
+    return nullptr;
+  }
+  chain_last = tail;
+  return head.next;
+}
+
+/**
+ * Destroys nodes going through "next" from first until stop, which is not destroyed. Length is not changed, the
+ * nodes must be already unlinked from list or not used by it any more.
+ *
+ * @return Number of destroyed nodes
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+size_t List<T, Allocator, Instrumentation>::DestroyChain(NodeBase* first, NodeBase* stop) noexcept {
+  size_t count = 0;
+  while (first != stop) {
+    NodeBase* next = first->next;
+    DestroyNode(first);
+    first = next;
+    ++count;
+  }
+  return count;
+}
+
+/**
+ * Unlinks nodes from first to the back of list and destroys them. first must not be &end_.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::EraseToEnd(NodeBase* first) noexcept {
+  Unlink(first, end_.prev);
+  length_ -= DestroyChain(first, &end_);
+}
+
+/**
+ * Calls reserve(count) of node allocator if it has one, does nothing otherwise.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::ReserveNodes(size_t count) {
+  if constexpr (HasReserve<NodeAllocator>::value) {
+    alloc_.reserve(count);
+  }
+}
+
+/**
+ * Links chain of count nodes from chain_first to chain_last before pos and adds count to length. Does nothing if count
+ * is 0.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::LinkChainBefore(NodeBase* pos,
+                                                          NodeBase* chain_first,
+                                                          NodeBase* chain_last,
+                                                          size_t count) noexcept {
+  if (count == 0) {
+    return;
+  }
+  LinkBefore(pos, chain_first, chain_last);
+  length_ += count;
+}
+
+/**
+ * Returns node with given index, &end_ if index is length_. Walks from the closer end of list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::NodeBase* List<T, Allocator, Instrumentation>::NodeAt(
+    size_t index) const noexcept {
+  NodeBase* node = const_cast<NodeBase*>(&end_);
+  if (index < length_ / 2) {
+    node = end_.next;
+    for (size_t i = 0; i < index; ++i) {
+      node = node->next;
+    }
+  } else {
+    for (size_t i = length_; i > index; --i) {
+      node = node->prev;
+    }
+  }
+  return node;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Nodes of this are reused, see AssignRange.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename InputIt, typename>
+void List<T, Allocator, Instrumentation>::assign(InputIt first, InputIt last) {
+  AssignRange(first, last);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Nodes of this are reused, see AssignRange.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::assign(size_t count, const T& value) {
+  NodeBase* current_node = end_.next;
+  size_t assigned = 0;
+  for (; current_node != &end_ && assigned < count; ++assigned) {
+    AsNode(current_node)->value = value;
+    this->OnValueCopied();
+    current_node = current_node->next;
+  }
+
+  if (current_node != &end_) {
+    EraseToEnd(current_node);
+  } else {
+    NodeBase* chain_last = nullptr;
+    NodeBase* chain_first = CreateChain(count - assigned, chain_last, value);
+    LinkChainBefore(&end_, chain_first, chain_last, count - assigned);
+  }
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::assign(std::initializer_list<T> init) {
+  AssignRange(init.begin(), init.end());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::resize(size_t count) {
+  ResizeWith(count);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::resize(size_t count, const T& value) {
+  ResizeWith(count, value);
+}
+
+/**
+ * Erases values after the first count ones, or appends values constructed from args until there are count of them.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename... Args_t>
+void List<T, Allocator, Instrumentation>::ResizeWith(size_t count, const Args_t& ...args) {
+  if (count < length_) {
+    EraseToEnd(NodeAt(count));
+  } else {
+    size_t added = count - length_;
+    NodeBase* chain_last = nullptr;
+    NodeBase* chain_first = CreateChain(added, chain_last, args...);
+    LinkChainBefore(&end_, chain_first, chain_last, added);
+  }
+}
+
 /**
  * Inserts node, constructed from args, to an empty list. If list is not empty, behaviour is undefined.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <typename... Args_t>
-void List<T, Allocator>::InsertToEmpty(Args_t&& ...args) {
-  end_.prev = NodeAllocatorTraits::allocate(alloc_, 1);
+void List<T, Allocator, Instrumentation>::InsertToEmpty(Args_t&& ...args) {
+  end_.prev = CreateNode(std::forward<Args_t>(args)...);
   end_.next = end_.prev;
 
-  NodeAllocatorTraits::construct(alloc_, AsNode(end_.prev), std::forward<Args_t>(args)...);
-
   end_.prev->next = &end_;
   end_.prev->prev = &end_;
 }
@@ -331,15 +602,14 @@ void List<T, Allocator>::InsertToEmpty(Args_t&& ...args) {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <typename... Args_t>
-void List<T, Allocator>::emplace_back(Args_t&& ...args) {
+void List<T, Allocator, Instrumentation>::emplace_back(Args_t&& ...args) {
   if (empty()) {
     InsertToEmpty(std::forward<Args_t>(args)...);
   } else {
     NodeBase* old_last = end_.prev;
-    old_last->next = NodeAllocatorTraits::allocate(alloc_, 1);
-    NodeAllocatorTraits::construct(alloc_, AsNode(old_last->next), std::forward<Args_t>(args)...);
+    old_last->next = CreateNode(std::forward<Args_t>(args)...);
     old_last->next->prev = old_last;
     old_last->next->next = &end_;
     end_.prev = old_last->next;
@@ -350,15 +620,14 @@ void List<T, Allocator>::emplace_back(Args_t&& ...args) {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <typename... Args_t>
-void List<T, Allocator>::emplace_front(Args_t&& ...args) {
+void List<T, Allocator, Instrumentation>::emplace_front(Args_t&& ...args) {
   if (empty()) {
     InsertToEmpty(std::forward<Args_t>(args)...);
   } else {
     NodeBase* old_first = end_.next;
-    old_first->prev = NodeAllocatorTraits::allocate(alloc_, 1);
-    NodeAllocatorTraits::construct(alloc_, AsNode(old_first->prev), std::forward<Args_t>(args)...);
+    old_first->prev = CreateNode(std::forward<Args_t>(args)...);
     old_first->prev->next = old_first;
     old_first->prev->prev = &end_;
     end_.next = old_first->prev;
@@ -369,14 +638,13 @@ void List<T, Allocator>::emplace_front(Args_t&& ...args) {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::pop_front() noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::pop_front() noexcept {
   if (length_ == 1) {
-    clear();
+    DestroyAllNodes();
   } else {
     NodeBase* new_first = end_.next->next;
-    NodeAllocatorTraits::destroy(alloc_, AsNode(end_.next));
-    NodeAllocatorTraits::deallocate(alloc_, AsNode(end_.next), 1);
+    DestroyNode(end_.next);
     end_.next = new_first;
     new_first->prev = &end_;
     length_--;
@@ -386,14 +654,13 @@ void List<T, Allocator>::pop_front() noexcept {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::pop_back() noexcept {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::pop_back() noexcept {
   if (length_ == 1) {
-    clear();
+    DestroyAllNodes();
   } else {
     NodeBase* new_last = end_.prev->prev;
-    NodeAllocatorTraits::destroy(alloc_, end_.prev);
-    NodeAllocatorTraits::deallocate(alloc_, AsNode(end_.prev), 1);
+    DestroyNode(end_.prev);
     end_.prev = new_last;
     new_last->next = &end_;
     length_--;
@@ -403,13 +670,13 @@ void List<T, Allocator>::pop_back() noexcept {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::push_front(const T& value) {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::push_front(const T& value) {
   emplace_front(value);
 }
 
-template <typename T, typename Allocator>
-void List<T, Allocator>::push_front(T&& value) {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::push_front(T&& value) {
   emplace_front(std::move(value));
 }
 
@@ -420,10 +687,8 @@ void List<T, Allocator>::push_front(T&& value) {
 /**
  * Increments iterator. Returns reference to itself after incrementing.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst>& List<T,
-                                                                    Allocator>::UnitedIterator<IsConst>::operator++() {
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+RingIterator<T, NodeType, Owner, IsConst>& RingIterator<T, NodeType, Owner, IsConst>::operator++() {
   current_node_ = current_node_->next;
   return *this;
 }
@@ -431,10 +696,8 @@ typename List<T, Allocator>::template UnitedIterator<IsConst>& List<T,
 /**
  * Decrements iterator. Returns reference to itself after decrementing.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst>& List<T,
-                                                                    Allocator>::UnitedIterator<IsConst>::operator--() {
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+RingIterator<T, NodeType, Owner, IsConst>& RingIterator<T, NodeType, Owner, IsConst>::operator--() {
   current_node_ = current_node_->prev;
   return *this;
 }
@@ -442,10 +705,8 @@ typename List<T, Allocator>::template UnitedIterator<IsConst>& List<T,
 /**
  * Increments iterator. Returns copy of itself before incrementing.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst> List<T, Allocator>::UnitedIterator<IsConst>::operator++(
-    int) {
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+RingIterator<T, NodeType, Owner, IsConst> RingIterator<T, NodeType, Owner, IsConst>::operator++(int) {
   auto copy = *this;
   current_node_ = current_node_->next;
   return copy;
@@ -454,10 +715,8 @@ typename List<T, Allocator>::template UnitedIterator<IsConst> List<T, Allocator>
 /**
  * Decrements iterator. Returns copy of itself before decrementing.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst> List<T, Allocator>::UnitedIterator<IsConst>::operator--(
-    int) {
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+RingIterator<T, NodeType, Owner, IsConst> RingIterator<T, NodeType, Owner, IsConst>::operator--(int) {
   auto copy = *this;
   current_node_ = current_node_->prev;
   return copy;
@@ -466,47 +725,44 @@ typename List<T, Allocator>::template UnitedIterator<IsConst> List<T, Allocator>
 /**
  * Constructs iterator from node.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
-List<T, Allocator>::UnitedIterator<IsConst>::UnitedIterator(NodeBase* node) : current_node_(node) {}
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+RingIterator<T, NodeType, Owner, IsConst>::RingIterator(NodeType* node) : current_node_(node) {}
 
 /**
  * Returns reference to a value in iterator. Reference is const when iterator is const, and not const otherwise.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst>::reference List<T,
-                                                                              Allocator>::UnitedIterator<IsConst>::operator*() const {
-  return AsNode(current_node_)->value;
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+typename RingIterator<T, NodeType, Owner, IsConst>::reference RingIterator<T, NodeType, Owner, IsConst>::operator*()
+    const {
+  return *Owner::ValueOf(current_node_);
 }
 
 /**
  * Returns pointer to a value in iterator. Pointer is const when iterator is const, and not const otherwise.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst>::pointer List<T,
-                                                                            Allocator>::UnitedIterator<IsConst>::operator->() const {
-  return &AsNode(current_node_)->value;
+template <typename T, typename NodeType, typename Owner, bool IsConst>
+typename RingIterator<T, NodeType, Owner, IsConst>::pointer RingIterator<T, NodeType, Owner, IsConst>::operator->()
+    const {
+  return Owner::ValueOf(current_node_);
 }
 
 /**
  * Returns true if iterators point at the same node, false otherwise.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
+template <typename T, typename NodeType, typename Owner, bool IsConst>
 template <bool IsConstOther>
-bool List<T, Allocator>::UnitedIterator<IsConst>::operator==(const UnitedIterator<IsConstOther>& other) {
+bool RingIterator<T, NodeType, Owner, IsConst>::operator==(
+    const RingIterator<T, NodeType, Owner, IsConstOther>& other) const {
   return current_node_ == other.current_node_;
 }
 
 /**
  * Returns false if iterators point at the same node, true otherwise.
  */
-template <typename T, typename Allocator>
-template <bool IsConst>
+template <typename T, typename NodeType, typename Owner, bool IsConst>
 template <bool IsConstOther>
-bool List<T, Allocator>::UnitedIterator<IsConst>::operator!=(const UnitedIterator<IsConstOther>& other) {
+bool RingIterator<T, NodeType, Owner, IsConst>::operator!=(
+    const RingIterator<T, NodeType, Owner, IsConstOther>& other) const {
   return current_node_ != other.current_node_;
 }
 
@@ -517,8 +773,8 @@ bool List<T, Allocator>::UnitedIterator<IsConst>::operator!=(const UnitedIterato
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::iterator List<T, Allocator>::begin() {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::iterator List<T, Allocator, Instrumentation>::begin() {
   auto it = UnitedIterator<false>(end_.next);
   return it;
 }
@@ -526,8 +782,8 @@ typename List<T, Allocator>::iterator List<T, Allocator>::begin() {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::iterator List<T, Allocator>::end() {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::iterator List<T, Allocator, Instrumentation>::end() {
   auto it = UnitedIterator<false>(&end_);
   return it;
 }
@@ -535,8 +791,8 @@ typename List<T, Allocator>::iterator List<T, Allocator>::end() {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_iterator List<T, Allocator>::cbegin() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_iterator List<T, Allocator, Instrumentation>::cbegin() const {
   auto it = UnitedIterator<true>(end_.next);
   return it;
 }
@@ -544,8 +800,8 @@ typename List<T, Allocator>::const_iterator List<T, Allocator>::cbegin() const {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_iterator List<T, Allocator>::cend() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_iterator List<T, Allocator, Instrumentation>::cend() const {
   auto it = UnitedIterator<true>(const_cast<NodeBase*>(&end_));
   return it;
 }
@@ -553,24 +809,24 @@ typename List<T, Allocator>::const_iterator List<T, Allocator>::cend() const {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_iterator List<T, Allocator>::begin() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_iterator List<T, Allocator, Instrumentation>::begin() const {
   return cbegin();
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_iterator List<T, Allocator>::end() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_iterator List<T, Allocator, Instrumentation>::end() const {
   return cend();
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::reverse_iterator List<T, Allocator>::rbegin() {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::reverse_iterator List<T, Allocator, Instrumentation>::rbegin() {
   auto it = reverse_iterator(end());
   return it;
 }
@@ -578,8 +834,8 @@ typename List<T, Allocator>::reverse_iterator List<T, Allocator>::rbegin() {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::reverse_iterator List<T, Allocator>::rend() {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::reverse_iterator List<T, Allocator, Instrumentation>::rend() {
   auto it = reverse_iterator(begin());
   return it;
 }
@@ -587,8 +843,10 @@ typename List<T, Allocator>::reverse_iterator List<T, Allocator>::rend() {
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::crbegin() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_reverse_iterator List<T,
+                                                                          Allocator,
+                                                                          Instrumentation>::crbegin() const {
   auto it = const_reverse_iterator(cend());
   return it;
 }
@@ -596,8 +854,10 @@ typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::crbegin(
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::crend() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_reverse_iterator List<T,
+                                                                          Allocator,
+                                                                          Instrumentation>::crend() const {
   auto it = const_reverse_iterator(cbegin());
   return it;
 }
@@ -605,32 +865,33 @@ typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::crend()
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::rbegin() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_reverse_iterator List<T,
+                                                                          Allocator,
+                                                                          Instrumentation>::rbegin() const {
   return crbegin();
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::const_reverse_iterator List<T, Allocator>::rend() const {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::const_reverse_iterator List<T, Allocator, Instrumentation>::rend() const {
   return crend();
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <bool IsConst, typename... Args_t>
-void List<T, Allocator>::emplace(List::UnitedIterator<IsConst> pos, Args_t&& ...args) {
+void List<T, Allocator, Instrumentation>::emplace(List::UnitedIterator<IsConst> pos, Args_t&& ...args) {
   if (pos == begin()) {
     emplace_front(std::forward<Args_t>(args)...);
   } else if (pos == end()) {
     emplace_back(std::forward<Args_t>(args)...);
   } else {
-    Node* new_node = NodeAllocatorTraits::allocate(alloc_, 1);
-    NodeAllocatorTraits::construct(alloc_, new_node, std::forward<Args_t>(args)...);
+    Node* new_node = CreateNode(std::forward<Args_t>(args)...);
     new_node->next = pos.current_node_;
     new_node->prev = pos.current_node_->prev;
     new_node->prev->next = new_node;
@@ -642,11 +903,13 @@ void List<T, Allocator>::emplace(List::UnitedIterator<IsConst> pos, Args_t&& ...
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
-                                                                   Allocator>::insert(List::UnitedIterator<IsConst> pos,
-                                                                                      const T& value) {
+typename List<T, Allocator, Instrumentation>::template UnitedIterator<IsConst> List<T,
+                                                                                    Allocator,
+                                                                                    Instrumentation>::insert(
+    List::UnitedIterator<IsConst> pos,
+    const T& value) {
   emplace(pos, value);
   return std::prev(pos);
 }
@@ -654,22 +917,82 @@ typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
-                                                                   Allocator>::insert(List::UnitedIterator<IsConst> pos,
-                                                                                      T&& value) {
+typename List<T, Allocator, Instrumentation>::template UnitedIterator<IsConst> List<T,
+                                                                                    Allocator,
+                                                                                    Instrumentation>::insert(
+    List::UnitedIterator<IsConst> pos,
+    T&& value) {
   emplace(pos, std::move(value));
   return std::prev(pos);
 }
 
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Copies are created as one chain, which is linked before pos at once.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst>
+typename List<T, Allocator, Instrumentation>::template UnitedIterator<IsConst> List<T,
+                                                                                    Allocator,
+                                                                                    Instrumentation>::insert(
+    List::UnitedIterator<IsConst> pos,
+    size_t count,
+    const T& value) {
+  NodeBase* chain_last = nullptr;
+  NodeBase* chain_first = CreateChain(count, chain_last, value);
+  if (count == 0) {
+    return pos;
+  }
+  LinkChainBefore(pos.current_node_, chain_first, chain_last, count);
+  return UnitedIterator<IsConst>(chain_first);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Values are created as one chain, which is linked before pos at once.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst, typename InputIt, typename>
+typename List<T, Allocator, Instrumentation>::template UnitedIterator<IsConst> List<T,
+                                                                                    Allocator,
+                                                                                    Instrumentation>::insert(
+    List::UnitedIterator<IsConst> pos,
+    InputIt first,
+    InputIt last) {
+  size_t count = 0;
+  NodeBase* chain_last = nullptr;
+  NodeBase* chain_first = CreateChainFromRange(first, last, chain_last, count);
+  if (count == 0) {
+    return pos;
+  }
+  LinkChainBefore(pos.current_node_, chain_first, chain_last, count);
+  return UnitedIterator<IsConst>(chain_first);
+}
+
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
 template <bool IsConst>
-typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
-                                                                   Allocator>::erase(List::UnitedIterator<IsConst> pos) {
+typename List<T, Allocator, Instrumentation>::template UnitedIterator<IsConst> List<T,
+                                                                                    Allocator,
+                                                                                    Instrumentation>::insert(
+    List::UnitedIterator<IsConst> pos,
+    std::initializer_list<T> init) {
+  return insert(pos, init.begin(), init.end());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst>
+typename List<T, Allocator, Instrumentation>::template UnitedIterator<IsConst> List<T,
+                                                                                    Allocator,
+                                                                                    Instrumentation>::erase(
+    List::UnitedIterator<IsConst> pos) {
   auto next_pos = std::next(pos);
   if (pos == begin()) {
     pop_front();
@@ -678,8 +1001,7 @@ typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
   } else {
     pos.current_node_->prev->next = pos.current_node_->next;
     pos.current_node_->next->prev = pos.current_node_->prev;
-    NodeAllocatorTraits::destroy(alloc_, AsNode(pos.current_node_));
-    NodeAllocatorTraits::deallocate(alloc_, AsNode(pos.current_node_), 1);
+    DestroyNode(pos.current_node_);
     length_--;
   }
   return next_pos;
@@ -688,15 +1010,135 @@ typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst, bool IsConstOther>
+typename List<T, Allocator, Instrumentation>::template UnitedIterator<IsConst> List<T,
+                                                                                    Allocator,
+                                                                                    Instrumentation>::erase(
+    List::UnitedIterator<IsConst> first,
+    List::UnitedIterator<IsConstOther> last) {
+  NodeBase* first_node = first.current_node_;
+  NodeBase* stop = last.current_node_;
+  if (first_node != stop) {
+    Unlink(first_node, stop->prev);
+    size_t count = DestroyChain(first_node, stop);
+    length_ -= count;
+    this->OnTraversal(ListOperation::kErase, count);
+  }
+  return UnitedIterator<IsConst>(stop);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Nodes are relinked, no values are constructed or destroyed. Allocators of lists must compare equal.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst>
+void List<T, Allocator, Instrumentation>::splice(List::UnitedIterator<IsConst> pos, List& other) {
+  assert(alloc_ == other.alloc_);
+  if (&other == this || other.empty()) {
+    return;
+  }
+
+  NodeBase* first = other.end_.next;
+  NodeBase* last = other.end_.prev;
+  Unlink(first, last);
+  LinkBefore(pos.current_node_, first, last);
+
+  this->OnNodesReceived(other.length_);
+  other.OnNodesGivenAway(other.length_);
+  length_ += other.length_;
+  other.length_ = 0;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst>
+void List<T, Allocator, Instrumentation>::splice(List::UnitedIterator<IsConst> pos, List&& other) {
+  splice(pos, other);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Node is relinked, no values are constructed or destroyed. Allocators of lists must compare equal.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
 template <bool IsConst, bool IsConstOther>
-typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
-                                                                   Allocator>::erase(List::UnitedIterator<IsConst> first,
-                                                                                     List::UnitedIterator<IsConstOther> last) {
-  for (auto it = first; it != last;) {
-    it = erase(it);
+void List<T, Allocator, Instrumentation>::splice(List::UnitedIterator<IsConst> pos,
+                                                 List& other,
+                                                 List::UnitedIterator<IsConstOther> it) {
+  assert(alloc_ == other.alloc_);
+  NodeBase* node = it.current_node_;
+  if (pos.current_node_ == node || pos.current_node_ == node->next) {
+    return;
   }
-  return last;
+
+  Unlink(node, node);
+  LinkBefore(pos.current_node_, node, node);
+
+  this->OnNodesReceived(1);
+  other.OnNodesGivenAway(1);
+  ++length_;
+  --other.length_;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst, bool IsConstOther>
+void List<T, Allocator, Instrumentation>::splice(List::UnitedIterator<IsConst> pos,
+                                                 List&& other,
+                                                 List::UnitedIterator<IsConstOther> it) {
+  splice(pos, other, it);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Nodes are relinked, no values are constructed or destroyed. Allocators of lists must compare equal. Takes constant
+ * time if other is this, otherwise nodes in range are counted, which is linear in their number.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst, bool IsConstFirst, bool IsConstLast>
+void List<T, Allocator, Instrumentation>::splice(List::UnitedIterator<IsConst> pos,
+                                                 List& other,
+                                                 List::UnitedIterator<IsConstFirst> first,
+                                                 List::UnitedIterator<IsConstLast> last) {
+  assert(alloc_ == other.alloc_);
+  if (first == last) {
+    return;
+  }
+
+  if (&other != this) {
+    size_t count = 0;
+    for (auto it = first; it != last; ++it) {
+      ++count;
+    }
+    this->OnTraversal(ListOperation::kSplice, count);
+    this->OnNodesReceived(count);
+    other.OnNodesGivenAway(count);
+    length_ += count;
+    other.length_ -= count;
+  }
+
+  NodeBase* first_node = first.current_node_;
+  NodeBase* last_node = last.current_node_->prev;
+  Unlink(first_node, last_node);
+  LinkBefore(pos.current_node_, first_node, last_node);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <bool IsConst, bool IsConstFirst, bool IsConstLast>
+void List<T, Allocator, Instrumentation>::splice(List::UnitedIterator<IsConst> pos,
+                                                 List&& other,
+                                                 List::UnitedIterator<IsConstFirst> first,
+                                                 List::UnitedIterator<IsConstLast> last) {
+  splice(pos, other, first, last);
 }
 
 //
@@ -707,8 +1149,8 @@ typename List<T, Allocator>::template UnitedIterator<IsConst> List<T,
  * Prints length and values in order they are in list.
  * For this function to work properly std::cout should be able to print value of type T.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::Print() const {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::Print() const {
   std::cout << "length: " << length_ << "\n";
   std::cout << "values:\n";
 
@@ -728,33 +1170,115 @@ void List<T, Allocator>::Print() const {
 /**
  * Checks if list is not "broken".
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::CheckStatus() {
-  int counter = 0;
-  NodeBase* current_node = end_.next;
-  const NodeBase* prev_node = &end_;
-  while (current_node != &end_) {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::CheckStatus() {
+  CheckRing(&end_, length_);
+}
+
+/**
+ * Checks links of a ring of nodes with sentinel end: "next" of every node is not null, "prev" of every node is the
+ * node before it, and there are exactly length nodes besides end. Nodes must have members "next" and "prev". Does
+ * nothing if NDEBUG is defined.
+ */
+template <typename NodeType>
+void CheckRing(const NodeType* end, size_t length) {
+#ifndef NDEBUG
+  size_t counter = 0;
+  const NodeType* prev_node = end;
+  for (const NodeType* current_node = end->next; current_node != end; current_node = current_node->next) {
+    assert(current_node != nullptr);
     assert(current_node->prev == prev_node);
     counter++;
-    AsNode(current_node)->value;
 
     prev_node = current_node;
-    current_node = current_node->next;
   }
-  assert(end_.prev == prev_node);
-  assert(counter == length_);
+  assert(end->prev == prev_node);
+  assert(counter == length);
+#else
+  (void)end;
+  (void)length;
+#endif
+}
+
+/**
+ * Links chain of nodes from first to last (inclusive) before pos. Chain must not be linked to any list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::LinkBefore(NodeBase* pos, NodeBase* first, NodeBase* last) noexcept {
+  first->prev = pos->prev;
+  last->next = pos;
+  pos->prev->next = first;
+  pos->prev = last;
+}
+
+/**
+ * Unlinks chain of nodes from first to last (inclusive) from its list. Links inside the chain are not changed.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::Unlink(NodeBase* first, NodeBase* last) noexcept {
+  first->prev->next = last->next;
+  last->next->prev = first->prev;
+}
+
+/**
+ * Merges two sorted null-terminated chains into one, linking it through "next". Node of left goes first among equal
+ * ones. "prev" links are not set. If comp throws, all nodes of both chains are left in one unsorted chain in left.
+ *
+ * @tparam Compare Type of comparator
+ * @param left First chain, may be nullptr, receives the merged chain
+ * @param right Second chain, may be nullptr
+ * @param comp Comparator, returns true if its first argument goes strictly before the second
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename Compare>
+void List<T, Allocator, Instrumentation>::MergeChains(NodeBase*& left, NodeBase* right, Compare& comp) {
+  NodeBase head;
+  NodeBase* tail = &head;
+  NodeBase* left_rest = left;
+  try {
+    while (left_rest != nullptr && right != nullptr) {
+      if (comp(AsNode(right)->value, AsNode(left_rest)->value)) {
+        tail->next = right;
+        right = right->next;
+      } else {
+        tail->next = left_rest;
+        left_rest = left_rest->next;
+      }
+      tail = tail->next;
+    }
+  } catch (...) {
+    // merged part is followed by the rest of left and then by the rest of right
+    tail->next = left_rest;
+    while (tail->next != nullptr) {
+      tail = tail->next;
+    }
+    tail->next = right;
+    left = head.next;
+    throw;
+  }
+  tail->next = left_rest != nullptr ? left_rest : right;
+
+  left = head.next;
 }
 
 /**
  * Unsafe cast from base class pointer NodeBase* to derived Node*.
  */
-template <typename T, typename Allocator>
-typename List<T, Allocator>::Node* List<T, Allocator>::AsNode(NodeBase* node_base) {
+template <typename T, typename Allocator, typename Instrumentation>
+typename List<T, Allocator, Instrumentation>::Node* List<T, Allocator, Instrumentation>::AsNode(NodeBase* node_base) {
   return static_cast<Node*>(node_base);
 }
 
-template <typename T, typename Allocator>
-void List<T, Allocator>::reverse() {
+/**
+ * Returns pointer to value of node, which must not be end_. Used by iterators.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+T* List<T, Allocator, Instrumentation>::ValueOf(NodeBase* node_base) {
+  return &AsNode(node_base)->value;
+}
+
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::reverse() {
   NodeBase* new_last = end_.next;
 
   NodeBase* current_pos = end_.next;
@@ -774,17 +1298,19 @@ void List<T, Allocator>::reverse() {
   current_pos->prev = &end_;
   end_.prev = new_last;
   end_.next = current_pos;
+  this->OnTraversal(ListOperation::kReverse, length_);
 }
 
 /**
  * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
  */
-template <typename T, typename Allocator>
-void List<T, Allocator>::unique() {
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::unique() {
   // goes from back to front, leaving only closest to back element in a group of adjacent equal elements
   if (empty()) {
     return;
   }
+  this->OnTraversal(ListOperation::kUnique, length_);
 
   NodeBase* last_in_equal_group = end_.prev;
   NodeBase* first_not_equal = last_in_equal_group->prev;
@@ -794,8 +1320,7 @@ void List<T, Allocator>::unique() {
     while (first_not_equal != &end_ && AsNode(first_not_equal)->value == AsNode(last_in_equal_group)->value) {
       ++to_skip;
       first_not_equal = first_not_equal->prev;
-      NodeAllocatorTraits::destroy(alloc_, AsNode(first_not_equal->next));
-      NodeAllocatorTraits::deallocate(alloc_, AsNode(first_not_equal->next), 1);
+      DestroyNode(first_not_equal->next);
     }
 
     assert(length_ >= to_skip);
@@ -814,3 +1339,179 @@ void List<T, Allocator>::unique() {
     first_not_equal = first_not_equal->prev;
   }
 }
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::merge(List& other) {
+  merge(other, std::less<T>());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::merge(List&& other) {
+  merge(other, std::less<T>());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Nodes of other are relinked into this, no values are constructed or destroyed. Allocators of lists must compare
+ * equal. If comp throws, both lists stay valid and keep the nodes they have at that moment.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename Compare>
+void List<T, Allocator, Instrumentation>::merge(List& other, Compare comp) {
+  assert(alloc_ == other.alloc_);
+  if (&other == this || other.empty()) {
+    return;
+  }
+
+  NodeBase* this_pointer = end_.next;
+  NodeBase* other_pointer = other.end_.next;
+  size_t moved = 0;
+  try {
+    while (other_pointer != &other.end_ && this_pointer != &end_) {
+      if (comp(AsNode(other_pointer)->value, AsNode(this_pointer)->value)) {
+        NodeBase* other_next = other_pointer->next;
+        Unlink(other_pointer, other_pointer);
+        LinkBefore(this_pointer, other_pointer, other_pointer);
+        other_pointer = other_next;
+        ++moved;
+      } else {
+        this_pointer = this_pointer->next;
+      }
+    }
+  } catch (...) {
+    // both lists stay valid, nodes already moved are counted in this
+    this->OnNodesReceived(moved);
+    other.OnNodesGivenAway(moved);
+    length_ += moved;
+    other.length_ -= moved;
+    throw;
+  }
+
+  if (other_pointer != &other.end_) {
+    NodeBase* other_last = other.end_.prev;
+    Unlink(other_pointer, other_last);
+    LinkBefore(&end_, other_pointer, other_last);
+  }
+
+  this->OnTraversal(ListOperation::kMerge, length_ + other.length_);
+  this->OnNodesReceived(other.length_);
+  other.OnNodesGivenAway(other.length_);
+  length_ += other.length_;
+  other.length_ = 0;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename Compare>
+void List<T, Allocator, Instrumentation>::merge(List&& other, Compare comp) {
+  merge(other, comp);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::sort() {
+  sort(std::less<T>());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Stable bottom-up merge sort. Nodes are relinked, no values are constructed or destroyed and no memory is allocated.
+ * While sorting, nodes form null-terminated chains through "next", "prev" links are restored at the end. Sorted chains
+ * are kept in bins like digits of a binary counter: bin i is empty or holds a chain of 2^i nodes, which are earlier in
+ * list than nodes of lower bins. Every next node is carried through the bins, merging equal-sized chains while they
+ * are still in cache. If comp throws, the list keeps all its nodes in unspecified order.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+template <typename Compare>
+void List<T, Allocator, Instrumentation>::sort(Compare comp) {
+  if (length_ < 2) {
+    return;
+  }
+
+  constexpr size_t kMaxBins = 64;
+  NodeBase* bins[kMaxBins] = {};
+  size_t used_bins = 0;
+
+  // every node is always either in one of the bins or in rest, so that the ring can be restored if comp throws
+  end_.prev->next = nullptr;
+  NodeBase* rest = end_.next;
+  NodeBase* sorted = nullptr;
+  try {
+    while (rest != nullptr) {
+      NodeBase* chain = rest;
+      rest = rest->next;
+      chain->next = nullptr;
+
+      size_t bin = 0;
+      for (; bin < used_bins && bins[bin] != nullptr; ++bin) {
+        MergeChains(bins[bin], chain, comp);
+        chain = bins[bin];
+        bins[bin] = nullptr;
+      }
+      if (bin == used_bins) {
+        ++used_bins;
+      }
+      bins[bin] = chain;
+    }
+
+    for (size_t bin = 0; bin < used_bins; ++bin) {
+      MergeChains(bins[bin], sorted, comp);
+      sorted = bins[bin];
+      bins[bin] = nullptr;
+    }
+  } catch (...) {
+    // links all chains back into the ring, the order of values is unspecified
+    NodeBase* prev_node = &end_;
+    for (size_t bin = used_bins; bin > 0; --bin) {
+      for (NodeBase* current_node = bins[bin - 1]; current_node != nullptr; current_node = current_node->next) {
+        prev_node->next = current_node;
+        current_node->prev = prev_node;
+        prev_node = current_node;
+      }
+    }
+    for (NodeBase* current_node = rest; current_node != nullptr; current_node = current_node->next) {
+      prev_node->next = current_node;
+      current_node->prev = prev_node;
+      prev_node = current_node;
+    }
+    prev_node->next = &end_;
+    end_.prev = prev_node;
+    throw;
+  }
+
+  NodeBase* prev_node = &end_;
+  for (NodeBase* current_node = sorted; current_node != nullptr; current_node = current_node->next) {
+    current_node->prev = prev_node;
+    prev_node = current_node;
+  }
+  end_.next = sorted;
+  end_.prev = prev_node;
+  prev_node->next = &end_;
+  this->OnTraversal(ListOperation::kSort, length_);
+}
+
+/**
+ * Returns counters of instrumentation policy. For NoInstrumentation they are empty.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+typename Instrumentation::Stats List<T, Allocator, Instrumentation>::GetStats() const noexcept {
+  return Instrumentation::GetStats();
+}
+
+/**
+ * Writes counters of instrumentation policy to out in one line, see list_instrumentation.hpp.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void List<T, Allocator, Instrumentation>::DumpStats(std::ostream& out) const {
+  GetStats().Dump(out);
+}
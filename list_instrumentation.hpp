@@ -0,0 +1,103 @@
+//
+// Instrumentation policies for List.
+//
+
+// Instrumentation is the third template parameter of List. List inherits from it privately and calls its hooks on
+// every node allocation and deallocation, element copy, move and in-place construction, transfer of nodes between
+// lists and node traversal. The default policy NoInstrumentation has empty inline hooks and no data members, so thanks
+// to the empty base optimization it costs nothing. CountingInstrumentation counts all events.
+
+// An instrumentation policy must be default-constructable and have the following members:
+//   struct Stats, which has member function void Dump(std::ostream& out) const;
+//   void OnNodeAllocated(size_t bytes) noexcept;
+//   void OnNodeDeallocated(size_t bytes) noexcept;
+//   void OnValueCopied() noexcept;
+//   void OnValueMoved() noexcept;
+//   void OnValueEmplaced() noexcept;
+//   void OnNodesReceived(size_t count) noexcept;
+//   void OnNodesGivenAway(size_t count) noexcept;
+//   void OnTraversal(ListOperation operation, size_t visited_nodes) noexcept;
+//   Stats GetStats() const noexcept;
+
+// OnNodesReceived is called for the list which receives count nodes of another list by moving, splicing or merging,
+// and OnNodesGivenAway for the list which gives them away. OnTraversal is called once per call of a traversing
+// operation with the number of nodes it has visited.
+
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+//
+// DECLARATIONS
+//
+
+enum class ListOperation {
+  kClear,
+  kCopy,
+  kErase,
+  kUnique,
+  kReverse,
+  kSort,
+  kMerge,
+  kSplice,
+  kCount
+};
+
+const char* ToString(ListOperation operation) noexcept;
+
+class NoInstrumentation {
+ public:
+  struct Stats {
+    void Dump(std::ostream& out) const;
+  };
+
+  void OnNodeAllocated(size_t) noexcept {}
+  void OnNodeDeallocated(size_t) noexcept {}
+  void OnValueCopied() noexcept {}
+  void OnValueMoved() noexcept {}
+  void OnValueEmplaced() noexcept {}
+  void OnNodesReceived(size_t) noexcept {}
+  void OnNodesGivenAway(size_t) noexcept {}
+  void OnTraversal(ListOperation, size_t) noexcept {}
+
+  Stats GetStats() const noexcept;
+};
+
+class CountingInstrumentation {
+ public:
+  struct Stats {
+    size_t allocations = 0;
+    size_t deallocations = 0;
+    size_t allocated_bytes = 0;
+    size_t deallocated_bytes = 0;
+    size_t live_nodes = 0;
+    size_t peak_live_nodes = 0;
+    size_t copies = 0;
+    size_t moves = 0;
+    size_t emplacements = 0;
+    size_t traversals[static_cast<size_t>(ListOperation::kCount)] = {};
+    size_t visited_nodes[static_cast<size_t>(ListOperation::kCount)] = {};
+
+    void Dump(std::ostream& out) const;
+  };
+
+  void OnNodeAllocated(size_t bytes) noexcept;
+  void OnNodeDeallocated(size_t bytes) noexcept;
+  void OnValueCopied() noexcept;
+  void OnValueMoved() noexcept;
+  void OnValueEmplaced() noexcept;
+  void OnNodesReceived(size_t count) noexcept;
+  void OnNodesGivenAway(size_t count) noexcept;
+  void OnTraversal(ListOperation operation, size_t visited_nodes) noexcept;
+
+  Stats GetStats() const noexcept;
+
+ private:
+  void UpdatePeak() noexcept;
+
+  Stats stats_;
+};
+
+#include "list_instrumentation.ipp"
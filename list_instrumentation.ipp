@@ -0,0 +1,125 @@
+//
+// This is a .ipp file for list_instrumentation.hpp. For more information check list_instrumentation.hpp.
+//
+
+/**
+ * Returns name of operation in snake_case, as it is used in stats dumps.
+ */
+inline const char* ToString(ListOperation operation) noexcept {
+  switch (operation) {
+    case ListOperation::kClear:
+      return "clear";
+    case ListOperation::kCopy:
+      return "copy";
+    case ListOperation::kErase:
+      return "erase";
+    case ListOperation::kUnique:
+      return "unique";
+    case ListOperation::kReverse:
+      return "reverse";
+    case ListOperation::kSort:
+      return "sort";
+    case ListOperation::kMerge:
+      return "merge";
+    case ListOperation::kSplice:
+      return "splice";
+    default:
+      return "unknown";
+  }
+}
+
+//
+// NO INSTRUMENTATION
+//
+
+/**
+ * Writes a line, which says that instrumentation is off.
+ */
+inline void NoInstrumentation::Stats::Dump(std::ostream& out) const {
+  out << "list_stats instrumentation=none\n";
+}
+
+/**
+ * Returns empty stats.
+ */
+inline NoInstrumentation::Stats NoInstrumentation::GetStats() const noexcept {
+  return Stats();
+}
+
+//
+// COUNTING INSTRUMENTATION
+//
+
+/**
+ * Writes all counters in one line of space separated key=value pairs, starting with "list_stats". Traversal counters
+ * are written for every operation as <operation>_traversals and <operation>_visited_nodes.
+ */
+inline void CountingInstrumentation::Stats::Dump(std::ostream& out) const {
+  out << "list_stats"
+      << " allocations=" << allocations
+      << " deallocations=" << deallocations
+      << " allocated_bytes=" << allocated_bytes
+      << " deallocated_bytes=" << deallocated_bytes
+      << " live_nodes=" << live_nodes
+      << " peak_live_nodes=" << peak_live_nodes
+      << " copies=" << copies
+      << " moves=" << moves
+      << " emplacements=" << emplacements;
+  for (size_t i = 0; i < static_cast<size_t>(ListOperation::kCount); ++i) {
+    const char* name = ToString(static_cast<ListOperation>(i));
+    out << " " << name << "_traversals=" << traversals[i] << " " << name << "_visited_nodes=" << visited_nodes[i];
+  }
+  out << "\n";
+}
+
+inline void CountingInstrumentation::OnNodeAllocated(size_t bytes) noexcept {
+  ++stats_.allocations;
+  stats_.allocated_bytes += bytes;
+  ++stats_.live_nodes;
+  UpdatePeak();
+}
+
+inline void CountingInstrumentation::OnNodeDeallocated(size_t bytes) noexcept {
+  ++stats_.deallocations;
+  stats_.deallocated_bytes += bytes;
+  --stats_.live_nodes;
+}
+
+inline void CountingInstrumentation::OnValueCopied() noexcept {
+  ++stats_.copies;
+}
+
+inline void CountingInstrumentation::OnValueMoved() noexcept {
+  ++stats_.moves;
+}
+
+inline void CountingInstrumentation::OnValueEmplaced() noexcept {
+  ++stats_.emplacements;
+}
+
+inline void CountingInstrumentation::OnNodesReceived(size_t count) noexcept {
+  stats_.live_nodes += count;
+  UpdatePeak();
+}
+
+inline void CountingInstrumentation::OnNodesGivenAway(size_t count) noexcept {
+  stats_.live_nodes -= count;
+}
+
+inline void CountingInstrumentation::OnTraversal(ListOperation operation, size_t visited_nodes) noexcept {
+  ++stats_.traversals[static_cast<size_t>(operation)];
+  stats_.visited_nodes[static_cast<size_t>(operation)] += visited_nodes;
+}
+
+/**
+ * Returns a copy of all counters.
+ */
+inline CountingInstrumentation::Stats CountingInstrumentation::GetStats() const noexcept {
+  return stats_;
+}
+
+inline void CountingInstrumentation::UpdatePeak() noexcept {
+  if (stats_.live_nodes > stats_.peak_live_nodes) {
+    stats_.peak_live_nodes = stats_.live_nodes;
+  }
+}
@@ -0,0 +1,88 @@
+//
+// Binary snapshots of List.
+//
+
+// WriteSnapshot writes values of a list to a binary stream, ReadSnapshot restores them. MappedListView, which maps a
+// snapshot file into memory and iterates its values in place, is in list_snapshot_mmap.hpp, as it needs POSIX.
+
+// Snapshot format, all numbers are in host byte order:
+//   SnapshotHeader (32 bytes): magic "LSNP", format version, flags, size of value, number of values and offset of the
+//                              first value from the start of snapshot;
+//   padding up to data_offset;
+//   values.
+// If flag kSnapshotRaw is set, values are stored as their object representations, sizeof(T) bytes each, and
+// data_offset is a multiple of alignof(T), so that a mapped file can be read as an array of T. Otherwise every value is
+// written by SnapshotTraits<T>::Write and read by SnapshotTraits<T>::Read.
+
+// SnapshotTraits<T> is a customization point. The primary template is defined for trivially copyable T and stores
+// them raw, the specialization for std::string stores the length as uint64_t followed by characters. For other types
+// it should be specialized with members
+//   static constexpr bool kIsRaw = false;
+//   static void Write(std::ostream& out, const T& value);
+//   static T Read(std::istream& in);
+
+// Errors of format or of stream, like a wrong or truncated snapshot, are reported by std::runtime_error.
+
+
+#pragma once
+
+#include "list.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+//
+// DECLARATIONS
+//
+
+struct SnapshotHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t flags;
+  uint32_t value_size;
+  uint64_t count;
+  uint64_t data_offset;
+};
+
+constexpr char kSnapshotMagic[4] = {'L', 'S', 'N', 'P'};
+constexpr uint32_t kSnapshotVersion = 1;
+constexpr uint32_t kSnapshotRaw = 1;
+
+template <typename T, typename = void>
+struct SnapshotTraits {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "SnapshotTraits must be specialized for types, which are not trivially copyable");
+
+  static constexpr bool kIsRaw = true;
+};
+
+template <>
+struct SnapshotTraits<std::string> {
+  static constexpr bool kIsRaw = false;
+
+  static void Write(std::ostream& out, const std::string& value);
+  static std::string Read(std::istream& in);
+};
+
+std::streamoff SnapshotBytesLeft(std::istream& in);
+
+template <typename T>
+SnapshotHeader MakeSnapshotHeader(uint64_t count);
+
+template <typename T>
+void CheckSnapshotHeader(const SnapshotHeader& header);
+
+template <typename T, typename Allocator, typename Instrumentation>
+void WriteSnapshot(std::ostream& out, const List<T, Allocator, Instrumentation>& list);
+
+template <typename T, typename Allocator, typename Instrumentation>
+void ReadSnapshot(std::istream& in, List<T, Allocator, Instrumentation>& list);
+
+#include "list_snapshot.ipp"
@@ -0,0 +1,200 @@
+//
+// This is a .ipp file for list_snapshot.hpp. For more information check list_snapshot.hpp.
+//
+
+//
+// SNAPSHOT TRAITS
+//
+
+/**
+ * Writes length of value as uint64_t and then its characters.
+ */
+inline void SnapshotTraits<std::string>::Write(std::ostream& out, const std::string& value) {
+  auto length = static_cast<uint64_t>(value.size());
+  out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+  out.write(value.data(), static_cast<std::streamsize>(value.size()));
+}
+
+/**
+ * Returns number of characters left in stream "in", or -1 if stream cannot tell it (like a pipe). Position of the stream
+ * is not changed.
+ */
+inline std::streamoff SnapshotBytesLeft(std::istream& in) {
+  std::streampos position = in.tellg();
+  if (position == std::streampos(-1)) {
+    return -1;
+  }
+  in.seekg(0, std::ios_base::end);
+  std::streampos end = in.tellg();
+  in.clear();
+  in.seekg(position);
+  if (end == std::streampos(-1)) {
+    return -1;
+  }
+  return end - position;
+}
+
+/**
+ * Reads string written by Write. Throws std::runtime_error if stream ends before the whole string is read.
+ * A wrong length in a corrupt snapshot must not cause a huge allocation: a long string is checked against the number
+ * of characters left in stream, and if the stream cannot tell it, the string is read in blocks of 64 KiB.
+ */
+inline std::string SnapshotTraits<std::string>::Read(std::istream& in) {
+  uint64_t length = 0;
+  in.read(reinterpret_cast<char*>(&length), sizeof(length));
+  if (!in) {
+    throw std::runtime_error("Snapshot is truncated");
+  }
+
+  constexpr uint64_t kBlockLength = 1 << 16;
+  uint64_t block_length = kBlockLength;
+  if (length > kBlockLength) {
+    std::streamoff bytes_left = SnapshotBytesLeft(in);
+    if (bytes_left >= 0 && length > static_cast<uint64_t>(bytes_left)) {
+      throw std::runtime_error("Snapshot is truncated");
+    }
+    if (bytes_left >= 0) {
+      block_length = length;
+    }
+  }
+
+  std::string value;
+  for (uint64_t read = 0; read < length;) {
+    auto count = static_cast<size_t>(std::min(block_length, length - read));
+    value.resize(static_cast<size_t>(read) + count);
+    in.read(value.data() + read, static_cast<std::streamsize>(count));
+    if (!in) {
+      throw std::runtime_error("Snapshot is truncated");
+    }
+    read += count;
+  }
+  return value;
+}
+
+//
+// SNAPSHOT HEADER
+//
+
+/**
+ * Returns header of snapshot of count values of type T.
+ */
+template <typename T>
+SnapshotHeader MakeSnapshotHeader(uint64_t count) {
+  SnapshotHeader header{};
+  std::memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+  header.version = kSnapshotVersion;
+  header.count = count;
+  header.data_offset = sizeof(SnapshotHeader);
+  if constexpr (SnapshotTraits<T>::kIsRaw) {
+    header.flags = kSnapshotRaw;
+    header.value_size = sizeof(T);
+    header.data_offset = (header.data_offset + alignof(T) - 1) / alignof(T) * alignof(T);
+  }
+  return header;
+}
+
+/**
+ * Throws std::runtime_error if header is not a header of snapshot of values of type T, written with the same version
+ * of format.
+ */
+template <typename T>
+void CheckSnapshotHeader(const SnapshotHeader& header) {
+  if (std::memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0) {
+    throw std::runtime_error("Not a snapshot of List");
+  }
+  if (header.version != kSnapshotVersion) {
+    throw std::runtime_error("Unsupported snapshot version " + std::to_string(header.version));
+  }
+
+  SnapshotHeader expected = MakeSnapshotHeader<T>(header.count);
+  if (header.flags != expected.flags || header.value_size != expected.value_size) {
+    throw std::runtime_error("Snapshot was written for another value type");
+  }
+  if (header.data_offset < sizeof(SnapshotHeader) || header.data_offset % alignof(T) != 0) {
+    throw std::runtime_error("Snapshot has wrong data offset");
+  }
+}
+
+//
+// WRITING AND READING
+//
+
+/**
+ * Writes snapshot of list to out. Raw values are copied to a buffer and written in blocks of about 64 KiB. Throws
+ * std::runtime_error if out fails.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void WriteSnapshot(std::ostream& out, const List<T, Allocator, Instrumentation>& list) {
+  SnapshotHeader header = MakeSnapshotHeader<T>(list.size());
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  for (size_t i = sizeof(header); i < header.data_offset; ++i) {
+    out.put('\0');
+  }
+
+  if constexpr (SnapshotTraits<T>::kIsRaw) {
+    constexpr size_t kBlockBytes = 1 << 16;
+    constexpr size_t kBlockSize = kBlockBytes / sizeof(T) > 0 ? kBlockBytes / sizeof(T) : 1;
+    auto block = std::make_unique<char[]>(kBlockSize * sizeof(T));
+
+    size_t in_block = 0;
+    for (const T& value : list) {
+      std::memcpy(block.get() + in_block * sizeof(T), &value, sizeof(T));
+      if (++in_block == kBlockSize) {
+        out.write(block.get(), static_cast<std::streamsize>(in_block * sizeof(T)));
+        in_block = 0;
+      }
+    }
+    out.write(block.get(), static_cast<std::streamsize>(in_block * sizeof(T)));
+  } else {
+    for (const T& value : list) {
+      SnapshotTraits<T>::Write(out, value);
+    }
+  }
+
+  if (!out) {
+    throw std::runtime_error("Failed to write snapshot");
+  }
+}
+
+/**
+ * Replaces values of list with values from snapshot in "in". Raw values are read in blocks of about 64 KiB, and every
+ * block is inserted as one chain of nodes. Throws std::runtime_error if snapshot is wrong or truncated, list then
+ * contains values read before the error.
+ */
+template <typename T, typename Allocator, typename Instrumentation>
+void ReadSnapshot(std::istream& in, List<T, Allocator, Instrumentation>& list) {
+  SnapshotHeader header{};
+  in.read(reinterpret_cast<char*>(&header), sizeof(header));
+  if (!in) {
+    throw std::runtime_error("Snapshot is truncated");
+  }
+  CheckSnapshotHeader<T>(header);
+  auto padding = static_cast<std::streamsize>(header.data_offset - sizeof(header));
+  in.ignore(padding);
+  if (!in || in.gcount() != padding) {
+    throw std::runtime_error("Snapshot is truncated");
+  }
+
+  list.clear();
+  if constexpr (SnapshotTraits<T>::kIsRaw) {
+    constexpr size_t kBlockBytes = 1 << 16;
+    constexpr size_t kBlockSize = kBlockBytes / sizeof(T) > 0 ? kBlockBytes / sizeof(T) : 1;
+    // values are read into the object representations of live T, which is allowed for trivially copyable T
+    static_assert(std::is_default_constructible_v<T>, "Raw values are restored into an array of default-initialized T");
+    std::unique_ptr<T[]> block(new T[kBlockSize]);
+
+    for (uint64_t read = 0; read < header.count;) {
+      size_t count = static_cast<size_t>(std::min<uint64_t>(kBlockSize, header.count - read));
+      in.read(reinterpret_cast<char*>(block.get()), static_cast<std::streamsize>(count * sizeof(T)));
+      if (!in) {
+        throw std::runtime_error("Snapshot is truncated");
+      }
+      list.insert(list.end(), block.get(), block.get() + count);
+      read += count;
+    }
+  } else {
+    for (uint64_t i = 0; i < header.count; ++i) {
+      list.emplace_back(SnapshotTraits<T>::Read(in));
+    }
+  }
+}
@@ -0,0 +1,117 @@
+//
+// Class MappedListView is a memory-mapped read-only view of a snapshot of List.
+//
+
+// MappedListView maps a snapshot file, written by WriteSnapshot (see list_snapshot.hpp), into memory and iterates its
+// values in place, without creating a list. Only snapshots of raw values can be viewed.
+
+// No objects of type T are created in the mapping, so values are never read through a T* into it. Iterators are
+// MappedIterator<T>, which keeps a byte pointer and copies the value into a T by std::memcpy on every dereference, and
+// front and back return values too. For trivially copyable T the copy compiles to a plain load.
+
+// MappedListView uses POSIX mmap, so it is kept apart from the portable stream functions of list_snapshot.hpp. Errors
+// are reported by exceptions: std::runtime_error for a wrong or truncated snapshot, std::system_error when a file
+// cannot be opened or mapped.
+
+
+#pragma once
+
+#include "list_snapshot.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//
+// DECLARATIONS
+//
+
+template <typename T>
+class MappedIterator;
+
+template <typename T>
+class MappedListView {
+ public:
+  static_assert(SnapshotTraits<T>::kIsRaw, "MappedListView can only view snapshots of raw values");
+
+  using value_type = T;
+  using reference = T;
+  using const_reference = T;
+  using size_type = size_t;
+  using const_iterator = MappedIterator<T>;
+  using iterator = const_iterator;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using reverse_iterator = const_reverse_iterator;
+  using difference_type = std::ptrdiff_t;
+
+  explicit MappedListView(const std::string& path);
+  MappedListView(const MappedListView& other) = delete;
+  MappedListView(MappedListView&& other) noexcept;
+
+  ~MappedListView() noexcept;
+
+  MappedListView& operator=(const MappedListView& other) = delete;
+  MappedListView& operator=(MappedListView&& other) noexcept;
+
+  size_t size() const noexcept;
+  bool empty() const noexcept;
+
+  T front() const noexcept;
+  T back() const noexcept;
+
+  const_iterator begin() const noexcept;
+  const_iterator end() const noexcept;
+
+  const_iterator cbegin() const noexcept;
+  const_iterator cend() const noexcept;
+
+  const_reverse_iterator rbegin() const noexcept;
+  const_reverse_iterator rend() const noexcept;
+
+  const_reverse_iterator crbegin() const noexcept;
+  const_reverse_iterator crend() const noexcept;
+
+ private:
+  void Unmap() noexcept;
+
+  void* mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  const unsigned char* values_ = nullptr;
+  size_t count_ = 0;
+};
+
+template <typename T>
+class MappedIterator {
+ public:
+  explicit MappedIterator(const unsigned char* position);
+
+  MappedIterator operator++(int);
+  MappedIterator operator--(int);
+
+  MappedIterator& operator++();
+  MappedIterator& operator--();
+
+  using pointer = void;
+  using reference = T;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+
+  reference operator*() const;
+
+  bool operator==(const MappedIterator& other) const;
+  bool operator!=(const MappedIterator& other) const;
+
+ private:
+  const unsigned char* position_;
+};
+
+#include "list_snapshot_mmap.ipp"
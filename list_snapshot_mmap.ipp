@@ -0,0 +1,297 @@
+//
+// This is a .ipp file for list_snapshot_mmap.hpp. For more information check list_snapshot_mmap.hpp.
+//
+
+//
+// MAPPED LIST VIEW CONSTRUCTORS
+//
+
+/**
+ * Maps snapshot file at path into memory read-only. Throws std::system_error if file cannot be opened or mapped, and
+ * std::runtime_error if it is not a snapshot of raw values of type T or is truncated.
+ */
+template <typename T>
+MappedListView<T>::MappedListView(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd == -1) {
+    throw std::system_error(errno, std::generic_category(), "Failed to open " + path);
+  }
+
+  struct stat file_stat{};
+  if (::fstat(fd, &file_stat) == -1) {
+    int error = errno;
+    ::close(fd);
+    throw std::system_error(error, std::generic_category(), "Failed to stat " + path);
+  }
+  auto file_size = static_cast<size_t>(file_stat.st_size);
+  if (file_size < sizeof(SnapshotHeader)) {
+    ::close(fd);
+    throw std::runtime_error("Snapshot is truncated");
+  }
+
+  void* mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  int error = errno;
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    throw std::system_error(error, std::generic_category(), "Failed to map " + path);
+  }
+  mapping_ = mapping;
+  mapping_size_ = file_size;
+
+  try {
+    SnapshotHeader header{};
+    std::memcpy(&header, mapping_, sizeof(header));
+    CheckSnapshotHeader<T>(header);
+    if (header.data_offset > file_size || header.count > (file_size - header.data_offset) / sizeof(T)) {
+      throw std::runtime_error("Snapshot is truncated");
+    }
+
+    values_ = static_cast<const unsigned char*>(mapping_) + header.data_offset;
+    count_ = static_cast<size_t>(header.count);
+  } catch (...) {
+    Unmap();
+    throw;
+  }
+  // values are usually scanned from front to back, so the kernel may read ahead
+  ::madvise(mapping_, mapping_size_, MADV_SEQUENTIAL);
+}
+
+/**
+ * Takes mapping of other, other becomes empty.
+ */
+template <typename T>
+MappedListView<T>::MappedListView(MappedListView&& other) noexcept
+    : mapping_(other.mapping_), mapping_size_(other.mapping_size_), values_(other.values_), count_(other.count_) {
+  other.mapping_ = nullptr;
+  other.mapping_size_ = 0;
+  other.values_ = nullptr;
+  other.count_ = 0;
+}
+
+//
+// MAPPED LIST VIEW DESTRUCTOR
+//
+
+/**
+ * Unmaps file. Iterators and references to values become invalid.
+ */
+template <typename T>
+MappedListView<T>::~MappedListView() noexcept {
+  Unmap();
+}
+
+//
+// MAPPED LIST VIEW ASSIGNMENT OPERATORS
+//
+
+/**
+ * Unmaps own file and takes mapping of other, other becomes empty.
+ */
+template <typename T>
+MappedListView<T>& MappedListView<T>::operator=(MappedListView&& other) noexcept {
+  if (&other == this) {
+    return *this;
+  }
+  Unmap();
+
+  mapping_ = other.mapping_;
+  mapping_size_ = other.mapping_size_;
+  values_ = other.values_;
+  count_ = other.count_;
+
+  other.mapping_ = nullptr;
+  other.mapping_size_ = 0;
+  other.values_ = nullptr;
+  other.count_ = 0;
+
+  return *this;
+}
+
+//
+// MAPPED LIST VIEW FUNCTIONS
+//
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+size_t MappedListView<T>::size() const noexcept {
+  return count_;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+bool MappedListView<T>::empty() const noexcept {
+  return count_ == 0;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+T MappedListView<T>::front() const noexcept {
+  return *begin();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+T MappedListView<T>::back() const noexcept {
+  return *--end();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_iterator MappedListView<T>::begin() const noexcept {
+  return const_iterator(values_);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_iterator MappedListView<T>::end() const noexcept {
+  return const_iterator(values_ + count_ * sizeof(T));
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_iterator MappedListView<T>::cbegin() const noexcept {
+  return begin();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_iterator MappedListView<T>::cend() const noexcept {
+  return end();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_reverse_iterator MappedListView<T>::rbegin() const noexcept {
+  return const_reverse_iterator(end());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_reverse_iterator MappedListView<T>::rend() const noexcept {
+  return const_reverse_iterator(begin());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_reverse_iterator MappedListView<T>::crbegin() const noexcept {
+  return rbegin();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T>
+typename MappedListView<T>::const_reverse_iterator MappedListView<T>::crend() const noexcept {
+  return rend();
+}
+
+/**
+ * Unmaps file if it is mapped.
+ */
+template <typename T>
+void MappedListView<T>::Unmap() noexcept {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, mapping_size_);
+  }
+  mapping_ = nullptr;
+  mapping_size_ = 0;
+  values_ = nullptr;
+  count_ = 0;
+}
+
+//
+// MAPPED ITERATOR
+//
+
+/**
+ * Constructs iterator from position of a value in mapping.
+ */
+template <typename T>
+MappedIterator<T>::MappedIterator(const unsigned char* position) : position_(position) {}
+
+/**
+ * Increments iterator. Returns reference to itself after incrementing.
+ */
+template <typename T>
+MappedIterator<T>& MappedIterator<T>::operator++() {
+  position_ += sizeof(T);
+  return *this;
+}
+
+/**
+ * Decrements iterator. Returns reference to itself after decrementing.
+ */
+template <typename T>
+MappedIterator<T>& MappedIterator<T>::operator--() {
+  position_ -= sizeof(T);
+  return *this;
+}
+
+/**
+ * Increments iterator. Returns copy of itself before incrementing.
+ */
+template <typename T>
+MappedIterator<T> MappedIterator<T>::operator++(int) {
+  auto copy = *this;
+  position_ += sizeof(T);
+  return copy;
+}
+
+/**
+ * Decrements iterator. Returns copy of itself before decrementing.
+ */
+template <typename T>
+MappedIterator<T> MappedIterator<T>::operator--(int) {
+  auto copy = *this;
+  position_ -= sizeof(T);
+  return copy;
+}
+
+/**
+ * Returns copy of a value in iterator. The bytes are copied into a new T, because no T was ever created in mapping.
+ */
+template <typename T>
+typename MappedIterator<T>::reference MappedIterator<T>::operator*() const {
+  static_assert(std::is_default_constructible_v<T>, "Mapped values are copied into a default-initialized T");
+  T value;
+  std::memcpy(&value, position_, sizeof(T));
+  return value;
+}
+
+/**
+ * Returns true if iterators point at the same value, false otherwise.
+ */
+template <typename T>
+bool MappedIterator<T>::operator==(const MappedIterator& other) const {
+  return position_ == other.position_;
+}
+
+/**
+ * Returns false if iterators point at the same value, true otherwise.
+ */
+template <typename T>
+bool MappedIterator<T>::operator!=(const MappedIterator& other) const {
+  return position_ != other.position_;
+}
@@ -0,0 +1,118 @@
+//
+// Class LruCache implements a key-value cache, which evicts the least recently used entries.
+//
+
+// Template parameters K and V are types of keys and values. Hash and KeyEqual are hash function and equality of keys
+// as in std::unordered_map. Allocator is an allocator type for std::pair<const K, V>, it is rebound for nodes of
+// List and of the index.
+
+// Entries are kept in a List in recency order, the most recently used one is at the front. An std::unordered_map
+// ("index") maps keys to iterators of this list. On a hit the node of entry is moved to the front by splice, which only
+// relinks it: no allocation, no construction, no move of value. When put adds a new key to a cache, which is full by
+// number of entries, the least recently used entry is overwritten in place: its list node is reused, and its index node
+// is extracted, rekeyed and inserted back, so that steady-state misses do not allocate either.
+
+// Cache is bounded by the number of entries (max_entries) and by the total size of entries (max_bytes), which is the
+// sum of sizes passed to put. After every put both bounds hold, entries are evicted from the back of recency order.
+// An eviction callback, if set, is called with key and value of every entry evicted because of bounds (not of erase or
+// clear) before it is destroyed or overwritten. It must not use the cache.
+
+// Hits, misses and evictions are counted, see GetStats. CheckStatus checks with asserts that the index and the list
+// have the same entries and that bytes() is the sum of their sizes.
+
+// LruCache is not thread-safe.
+
+
+#pragma once
+
+#include "list.hpp"
+
+#include <cassert>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+
+//
+// DECLARATIONS
+//
+
+template <typename K,
+          typename V,
+          typename Hash = std::hash<K>,
+          typename KeyEqual = std::equal_to<K>,
+          typename Allocator = std::allocator<std::pair<const K, V>>>
+class LruCache {
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = size_t;
+  using EvictionCallback = std::function<void(const K& key, V& value)>;
+
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+  };
+
+  explicit LruCache(size_t max_entries,
+                    size_t max_bytes = std::numeric_limits<size_t>::max(),
+                    EvictionCallback on_eviction = nullptr);
+  LruCache(const LruCache& other) = delete;
+  LruCache& operator=(const LruCache& other) = delete;
+
+  V* get(const K& key);
+  bool contains(const K& key) const;
+
+  void put(const K& key, V value, size_t bytes = 0);
+  bool erase(const K& key);
+  void clear() noexcept;
+
+  size_t size() const noexcept;
+  bool empty() const noexcept;
+  size_t bytes() const noexcept;
+
+  size_t max_entries() const noexcept;
+  size_t max_bytes() const noexcept;
+
+  Stats GetStats() const noexcept;
+  void ResetStats() noexcept;
+
+  void CheckStatus() const;
+
+ private:
+  struct Entry {
+    K key;
+    V value;
+    size_t bytes;
+
+    Entry(const K& key, V&& value, size_t bytes);
+  };
+
+  using AllocatorTraits = std::allocator_traits<Allocator>;
+  using Order = List<Entry, typename AllocatorTraits::template rebind_alloc<Entry>>;
+  using OrderIterator = typename Order::iterator;
+  using Index = std::unordered_map<K,
+                                   OrderIterator,
+                                   Hash,
+                                   KeyEqual,
+                                   typename AllocatorTraits::template rebind_alloc<std::pair<const K, OrderIterator>>>;
+
+  // index is reserved for max_entries in constructor, but not for more, so that a huge bound does not take memory
+  static constexpr size_t kMaxReservedEntries = 1 << 16;
+
+  void Touch(OrderIterator it);
+  void ReuseBack(const K& key, V&& value, size_t bytes);
+  void EvictBack();
+  void EvictWhileOverBounds();
+
+  Order order_;
+  Index index_;
+  size_t bytes_ = 0;
+  size_t max_entries_;
+  size_t max_bytes_;
+  EvictionCallback on_eviction_;
+  Stats stats_;
+};
+
+#include "lru_cache.ipp"
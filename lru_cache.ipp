@@ -0,0 +1,262 @@
+//
+// This is a .ipp file for lru_cache.hpp. For more information check lru_cache.hpp.
+//
+
+//
+// ENTRY CONSTRUCTOR
+//
+
+/**
+ * Constructs entry with a copy of key and moved value.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+LruCache<K, V, Hash, KeyEqual, Allocator>::Entry::Entry(const K& key, V&& value, size_t bytes)
+    : key(key), value(std::move(value)), bytes(bytes) {}
+
+//
+// LRU CACHE CONSTRUCTORS
+//
+
+/**
+ * Constructs empty cache.
+ *
+ * @param max_entries Maximal number of entries, cache with 0 entries stores nothing
+ * @param max_bytes Maximal sum of sizes of entries
+ * @param on_eviction Function to be called for every evicted entry, may be empty
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+LruCache<K, V, Hash, KeyEqual, Allocator>::LruCache(size_t max_entries,
+                                                    size_t max_bytes,
+                                                    EvictionCallback on_eviction)
+    : max_entries_(max_entries), max_bytes_(max_bytes), on_eviction_(std::move(on_eviction)) {
+  index_.reserve(max_entries_ < kMaxReservedEntries ? max_entries_ : kMaxReservedEntries);
+}
+
+//
+// LRU CACHE FUNCTIONS
+//
+
+/**
+ * Returns pointer to value of key and makes it the most recently used entry, or nullptr if there is no such key.
+ * Counts a hit or a miss. Pointer stays valid until the entry is erased or evicted.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+V* LruCache<K, V, Hash, KeyEqual, Allocator>::get(const K& key) {
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    ++stats_.misses;
+    return nullptr;
+  }
+
+  ++stats_.hits;
+  Touch(found->second);
+  return &found->second->value;
+}
+
+/**
+ * Returns true if there is an entry with key. Does not change recency and counters.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+bool LruCache<K, V, Hash, KeyEqual, Allocator>::contains(const K& key) const {
+  return index_.find(key) != index_.end();
+}
+
+/**
+ * Sets value of key and makes it the most recently used entry, then evicts entries until both bounds hold. If the new
+ * entry alone exceeds max_bytes, it is evicted too.
+ *
+ * @param key Key
+ * @param value Value, it is moved into cache
+ * @param bytes Size of entry, counted against max_bytes
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::put(const K& key, V value, size_t bytes) {
+  if (max_entries_ == 0) {
+    return;
+  }
+
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    OrderIterator it = found->second;
+    it->value = std::move(value);
+    bytes_ = bytes_ - it->bytes + bytes;
+    it->bytes = bytes;
+    Touch(it);
+  } else if (order_.size() == max_entries_) {
+    ReuseBack(key, std::move(value), bytes);
+  } else {
+    order_.emplace_front(key, std::move(value), bytes);
+    try {
+      index_.emplace(key, order_.begin());
+    } catch (...) {
+      order_.pop_front();
+      throw;
+    }
+    bytes_ += bytes;
+  }
+
+  EvictWhileOverBounds();
+}
+
+/**
+ * Removes entry with key without calling eviction callback. Returns true if there was such entry.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+bool LruCache<K, V, Hash, KeyEqual, Allocator>::erase(const K& key) {
+  auto found = index_.find(key);
+  if (found == index_.end()) {
+    return false;
+  }
+
+  OrderIterator it = found->second;
+  bytes_ -= it->bytes;
+  index_.erase(found);
+  order_.erase(it);
+  return true;
+}
+
+/**
+ * Removes all entries without calling eviction callback. Counters are not reset.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::clear() noexcept {
+  index_.clear();
+  order_.clear();
+  bytes_ = 0;
+}
+
+/**
+ * Returns number of entries.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+size_t LruCache<K, V, Hash, KeyEqual, Allocator>::size() const noexcept {
+  return order_.size();
+}
+
+/**
+ * Returns true if there are no entries.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+bool LruCache<K, V, Hash, KeyEqual, Allocator>::empty() const noexcept {
+  return order_.empty();
+}
+
+/**
+ * Returns sum of sizes of entries.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+size_t LruCache<K, V, Hash, KeyEqual, Allocator>::bytes() const noexcept {
+  return bytes_;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+size_t LruCache<K, V, Hash, KeyEqual, Allocator>::max_entries() const noexcept {
+  return max_entries_;
+}
+
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+size_t LruCache<K, V, Hash, KeyEqual, Allocator>::max_bytes() const noexcept {
+  return max_bytes_;
+}
+
+/**
+ * Returns numbers of hits and misses of get and of evictions since construction or the last ResetStats.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+typename LruCache<K, V, Hash, KeyEqual, Allocator>::Stats LruCache<K, V, Hash, KeyEqual, Allocator>::GetStats()
+    const noexcept {
+  return stats_;
+}
+
+/**
+ * Sets all counters to zero.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::ResetStats() noexcept {
+  stats_ = Stats();
+}
+
+/**
+ * Checks if index_ and order_ have the same entries and bytes_ is the sum of their sizes. Does nothing if NDEBUG is
+ * defined.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::CheckStatus() const {
+#ifndef NDEBUG
+  assert(index_.size() == order_.size());
+  assert(order_.size() <= max_entries_);
+  size_t bytes = 0;
+  for (auto it = order_.begin(); it != order_.end(); ++it) {
+    auto found = index_.find(it->key);
+    assert(found != index_.end());
+    assert(&*found->second == &*it);
+    bytes += it->bytes;
+  }
+  assert(bytes == bytes_);
+#endif
+}
+
+/**
+ * Makes entry the most recently used one by relinking its node to the front of order_.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::Touch(OrderIterator it) {
+  order_.splice(order_.begin(), order_, it);
+}
+
+/**
+ * Evicts the least recently used entry and reuses its list node and index node for new entry, which becomes the most
+ * recently used one. Cache must not be empty. If assignment of key or value throws, the evicted entry is removed and
+ * the new one is not inserted.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::ReuseBack(const K& key, V&& value, size_t bytes) {
+  OrderIterator it = std::prev(order_.end());
+  if (on_eviction_) {
+    on_eviction_(it->key, it->value);
+  }
+  ++stats_.evictions;
+
+  auto index_node = index_.extract(it->key);
+  try {
+    index_node.key() = key;
+    it->key = key;
+    it->value = std::move(value);
+    index_.insert(std::move(index_node));
+  } catch (...) {
+    // the old entry is already evicted, its list node is erased too, so that index_ and order_ stay consistent
+    bytes_ -= it->bytes;
+    order_.erase(it);
+    throw;
+  }
+  bytes_ = bytes_ - it->bytes + bytes;
+  it->bytes = bytes;
+
+  Touch(it);
+}
+
+/**
+ * Evicts the least recently used entry. Cache must not be empty.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::EvictBack() {
+  OrderIterator it = std::prev(order_.end());
+  if (on_eviction_) {
+    on_eviction_(it->key, it->value);
+  }
+  ++stats_.evictions;
+
+  bytes_ -= it->bytes;
+  index_.erase(it->key);
+  order_.pop_back();
+}
+
+/**
+ * Evicts entries from the back until both max_entries and max_bytes hold.
+ */
+template <typename K, typename V, typename Hash, typename KeyEqual, typename Allocator>
+void LruCache<K, V, Hash, KeyEqual, Allocator>::EvictWhileOverBounds() {
+  while (!order_.empty() && (order_.size() > max_entries_ || bytes_ > max_bytes_)) {
+    EvictBack();
+  }
+}
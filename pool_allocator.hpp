@@ -0,0 +1,141 @@
+//
+// Class PoolAllocator implements a slab allocator for node-based containers like List.
+//
+
+// Template parameter T is the type of allocated objects. SlabSize is the number of objects of one size that fit into
+// one slab, the contiguous block PoolAllocator requests from the global heap at once.
+
+// PoolAllocator meets the named requirements of Allocator. All copies and rebound copies of an allocator share one
+// SlabPoolResource, so memory allocated by one of them can be deallocated by any other. SlabPoolResource keeps a
+// separate pool for every object size, each pool hands out single objects from its slabs and keeps a free list of
+// released ones for reuse. Requests for more than one object go directly to the global heap.
+
+// reserve(count) makes sure that the next count single-object allocations do not request memory from the global heap,
+// taking it at once in one slab big enough for all of them. List calls it before creating a known number of nodes.
+
+// Copies and rebound copies of an allocator do not throw: the pool for objects of a type is looked up or created on the
+// first allocate or reserve.
+
+// Memory of slabs is returned to the global heap by release() (List calls it in clear() and in its destructor) when
+// there are no live objects in the pool, or when the last allocator sharing the SlabPoolResource is destroyed.
+
+// PoolAllocator is not thread-safe: allocators sharing one SlabPoolResource must not be used from different threads
+// simultaneously.
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include <new>
+
+//
+// DECLARATIONS
+//
+
+template <size_t SlabSize>
+class SlabPool;
+
+template <size_t SlabSize>
+class SlabPoolResource;
+
+template <typename T, size_t SlabSize = 256>
+class PoolAllocator {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  template <typename U>
+  struct rebind {
+    using other = PoolAllocator<U, SlabSize>;
+  };
+
+  PoolAllocator();
+  PoolAllocator(const PoolAllocator& other) noexcept;
+  template <typename U>
+  PoolAllocator(const PoolAllocator<U, SlabSize>& other) noexcept;
+
+  PoolAllocator& operator=(const PoolAllocator& other) noexcept;
+
+  T* allocate(size_t count);
+  void deallocate(T* pointer, size_t count) noexcept;
+
+  void reserve(size_t count);
+  void release() noexcept;
+
+  template <typename U>
+  bool operator==(const PoolAllocator<U, SlabSize>& other) const noexcept;
+  template <typename U>
+  bool operator!=(const PoolAllocator<U, SlabSize>& other) const noexcept;
+
+ private:
+  // Functions instead of constants, so that T may be incomplete when PoolAllocator<T> is instantiated
+  static constexpr size_t SlotAlignment();
+  static constexpr size_t SlotSize();
+
+  SlabPool<SlabSize>* Pool();
+
+  std::shared_ptr<SlabPoolResource<SlabSize>> resource_;
+  // Pool for objects of size of T, looked up on the first use, so that copying and rebinding do not throw
+  SlabPool<SlabSize>* pool_ = nullptr;
+
+  template <typename U, size_t OtherSlabSize>
+  friend class PoolAllocator;
+};
+
+// Pool of slots of one size. Does not depend on T, so that all rebound allocators can share it.
+template <size_t SlabSize>
+class SlabPool {
+ public:
+  SlabPool(size_t slot_size, size_t slot_alignment);
+  SlabPool(const SlabPool& other) = delete;
+  SlabPool& operator=(const SlabPool& other) = delete;
+
+  ~SlabPool() noexcept;
+
+  void* Allocate();
+  void Deallocate(void* pointer) noexcept;
+
+  void Reserve(size_t count);
+  void Release() noexcept;
+
+  bool Fits(size_t slot_size, size_t slot_alignment) const noexcept;
+
+ private:
+  // Released slot stores pointer to the next released slot
+  struct FreeSlot {
+    FreeSlot* next;
+  };
+
+  void AllocateSlab(size_t slot_count);
+
+  size_t slot_size_;
+  size_t slot_alignment_;
+
+  std::vector<void*> slabs_;
+  FreeSlot* free_list_ = nullptr;
+  size_t free_count_ = 0;
+  char* slab_current_ = nullptr;
+  char* slab_end_ = nullptr;
+  size_t live_count_ = 0;
+};
+
+// Set of pools of different slot sizes, shared by all copies and rebound copies of one PoolAllocator.
+template <size_t SlabSize>
+class SlabPoolResource {
+ public:
+  SlabPool<SlabSize>* PoolFor(size_t slot_size, size_t slot_alignment);
+  SlabPool<SlabSize>* FindPool(size_t slot_size, size_t slot_alignment) const noexcept;
+
+  void Release() noexcept;
+
+ private:
+  std::vector<std::unique_ptr<SlabPool<SlabSize>>> pools_;
+};
+
+#include "pool_allocator.ipp"
@@ -0,0 +1,317 @@
+//
+// This is a .ipp file for pool_allocator.hpp. For more information check pool_allocator.hpp.
+//
+
+//
+// POOL ALLOCATOR CONSTRUCTORS
+//
+
+/**
+ * Constructs allocator with a new empty SlabPoolResource.
+ */
+template <typename T, size_t SlabSize>
+PoolAllocator<T, SlabSize>::PoolAllocator() : resource_(std::make_shared<SlabPoolResource<SlabSize>>()) {}
+
+/**
+ * Constructs allocator sharing SlabPoolResource with other.
+ */
+template <typename T, size_t SlabSize>
+PoolAllocator<T, SlabSize>::PoolAllocator(const PoolAllocator& other) noexcept
+    : resource_(other.resource_), pool_(other.pool_) {}
+
+/**
+ * Constructs allocator sharing SlabPoolResource with other, which allocates objects of another type. The pool for
+ * objects of size of T is looked up on the first use.
+ */
+template <typename T, size_t SlabSize>
+template <typename U>
+PoolAllocator<T, SlabSize>::PoolAllocator(const PoolAllocator<U, SlabSize>& other) noexcept
+    : resource_(other.resource_) {}
+
+//
+// POOL ALLOCATOR ASSIGNMENT OPERATORS
+//
+
+/**
+ * Makes allocator share SlabPoolResource with other.
+ */
+template <typename T, size_t SlabSize>
+PoolAllocator<T, SlabSize>& PoolAllocator<T, SlabSize>::operator=(const PoolAllocator& other) noexcept {
+  resource_ = other.resource_;
+  pool_ = other.pool_;
+
+  return *this;
+}
+
+//
+// POOL ALLOCATOR FUNCTIONS
+//
+
+/**
+ * Allocates memory for count objects of type T. Single objects are taken from the pool, arrays from the global heap.
+ * Throws std::bad_array_new_length if the size of count objects does not fit into size_t.
+ *
+ * @param count Number of objects
+ * @return Pointer to the allocated memory
+ */
+template <typename T, size_t SlabSize>
+T* PoolAllocator<T, SlabSize>::allocate(size_t count) {
+  if (count == 1) {
+    return static_cast<T*>(Pool()->Allocate());
+  }
+  if (count > SIZE_MAX / sizeof(T)) {
+    throw std::bad_array_new_length();
+  }
+  return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+}
+
+/**
+ * Deallocates memory, allocated by this allocator or one sharing SlabPoolResource with it.
+ *
+ * @param pointer Pointer to the memory
+ * @param count Number of objects, must be the same as passed to allocate
+ */
+template <typename T, size_t SlabSize>
+void PoolAllocator<T, SlabSize>::deallocate(T* pointer, size_t count) noexcept {
+  if (count == 1) {
+    if (pool_ == nullptr) {
+      // memory was allocated by an allocator sharing resource_, so the pool for objects of this size exists
+      pool_ = resource_->FindPool(SlotSize(), SlotAlignment());
+    }
+    pool_->Deallocate(pointer);
+  } else {
+    ::operator delete(pointer, std::align_val_t(alignof(T)));
+  }
+}
+
+/**
+ * Makes sure that the next count allocations of single objects do not request memory from the global heap.
+ */
+template <typename T, size_t SlabSize>
+void PoolAllocator<T, SlabSize>::reserve(size_t count) {
+  Pool()->Reserve(count);
+}
+
+/**
+ * Returns slabs of every pool without live objects in shared SlabPoolResource to the global heap.
+ */
+template <typename T, size_t SlabSize>
+void PoolAllocator<T, SlabSize>::release() noexcept {
+  resource_->Release();
+}
+
+/**
+ * Returns true if memory allocated by this can be deallocated by other and vice versa.
+ */
+template <typename T, size_t SlabSize>
+template <typename U>
+bool PoolAllocator<T, SlabSize>::operator==(const PoolAllocator<U, SlabSize>& other) const noexcept {
+  return resource_ == other.resource_;
+}
+
+/**
+ * Returns false if memory allocated by this can be deallocated by other and vice versa.
+ */
+template <typename T, size_t SlabSize>
+template <typename U>
+bool PoolAllocator<T, SlabSize>::operator!=(const PoolAllocator<U, SlabSize>& other) const noexcept {
+  return resource_ != other.resource_;
+}
+
+/**
+ * Alignment of slots in pool, they must be able to store both T and pointer to the next free slot.
+ */
+template <typename T, size_t SlabSize>
+constexpr size_t PoolAllocator<T, SlabSize>::SlotAlignment() {
+  return alignof(T) > alignof(void*) ? alignof(T) : alignof(void*);
+}
+
+/**
+ * Size of slots in pool, they must be able to store both T and pointer to the next free slot.
+ */
+template <typename T, size_t SlabSize>
+constexpr size_t PoolAllocator<T, SlabSize>::SlotSize() {
+  size_t size = sizeof(T) > sizeof(void*) ? sizeof(T) : sizeof(void*);
+  return (size + SlotAlignment() - 1) / SlotAlignment() * SlotAlignment();
+}
+
+/**
+ * Returns pool for objects of size of T, creates it in resource_ on the first call. May throw std::bad_alloc.
+ */
+template <typename T, size_t SlabSize>
+SlabPool<SlabSize>* PoolAllocator<T, SlabSize>::Pool() {
+  if (pool_ == nullptr) {
+    pool_ = resource_->PoolFor(SlotSize(), SlotAlignment());
+  }
+  return pool_;
+}
+
+//
+// SLAB POOL
+//
+
+/**
+ * Constructs empty pool, memory is not allocated until the first call of Allocate.
+ */
+template <size_t SlabSize>
+SlabPool<SlabSize>::SlabPool(size_t slot_size, size_t slot_alignment)
+    : slot_size_(slot_size), slot_alignment_(slot_alignment) {}
+
+/**
+ * Returns all slabs to the global heap. Objects still living in them are not destroyed.
+ */
+template <size_t SlabSize>
+SlabPool<SlabSize>::~SlabPool() noexcept {
+  for (void* slab : slabs_) {
+    ::operator delete(slab, std::align_val_t(slot_alignment_));
+  }
+}
+
+/**
+ * Returns a free slot. Released slots are reused first, then the rest of the current slab, and only then a new slab
+ * is requested from the global heap.
+ */
+template <size_t SlabSize>
+void* SlabPool<SlabSize>::Allocate() {
+  ++live_count_;
+  if (free_list_ != nullptr) {
+    FreeSlot* slot = free_list_;
+    free_list_ = slot->next;
+    --free_count_;
+    return slot;
+  }
+  if (slab_current_ == slab_end_) {
+    try {
+      AllocateSlab(SlabSize);
+    } catch (...) {
+      --live_count_;
+      throw;
+    }
+  }
+  void* slot = slab_current_;
+  slab_current_ += slot_size_;
+  return slot;
+}
+
+/**
+ * Puts slot to the free list.
+ */
+template <size_t SlabSize>
+void SlabPool<SlabSize>::Deallocate(void* pointer) noexcept {
+  auto slot = static_cast<FreeSlot*>(pointer);
+  slot->next = free_list_;
+  free_list_ = slot;
+  ++free_count_;
+  --live_count_;
+}
+
+/**
+ * Makes sure that there are at least count free slots. If there are not, the rest of the current slab is moved to the
+ * free list and one slab of at least count slots is requested from the global heap. Throws std::bad_array_new_length
+ * if the size of that slab does not fit into size_t.
+ */
+template <size_t SlabSize>
+void SlabPool<SlabSize>::Reserve(size_t count) {
+  size_t slab_free_count = static_cast<size_t>(slab_end_ - slab_current_) / slot_size_;
+  if (free_count_ + slab_free_count >= count) {
+    return;
+  }
+
+  size_t slot_count = count - free_count_ - slab_free_count;
+  slot_count = slot_count > SlabSize ? slot_count : SlabSize;
+  if (slot_count > SIZE_MAX / slot_size_) {
+    throw std::bad_array_new_length();
+  }
+  for (; slab_current_ != slab_end_; slab_current_ += slot_size_) {
+    auto slot = reinterpret_cast<FreeSlot*>(slab_current_);
+    slot->next = free_list_;
+    free_list_ = slot;
+    ++free_count_;
+  }
+  AllocateSlab(slot_count);
+}
+
+/**
+ * Returns all slabs to the global heap if there are no live objects in them, does nothing otherwise.
+ */
+template <size_t SlabSize>
+void SlabPool<SlabSize>::Release() noexcept {
+  if (live_count_ != 0) {
+    return;
+  }
+  for (void* slab : slabs_) {
+    ::operator delete(slab, std::align_val_t(slot_alignment_));
+  }
+  slabs_.clear();
+  free_list_ = nullptr;
+  free_count_ = 0;
+  slab_current_ = nullptr;
+  slab_end_ = nullptr;
+}
+
+/**
+ * Returns true if pool hands out slots of exactly this size and alignment.
+ */
+template <size_t SlabSize>
+bool SlabPool<SlabSize>::Fits(size_t slot_size, size_t slot_alignment) const noexcept {
+  return slot_size_ == slot_size && slot_alignment_ == slot_alignment;
+}
+
+/**
+ * Requests a new slab of slot_count slots from the global heap and makes it current. Throws
+ * std::bad_array_new_length if the size of the slab does not fit into size_t.
+ */
+template <size_t SlabSize>
+void SlabPool<SlabSize>::AllocateSlab(size_t slot_count) {
+  if (slot_count > SIZE_MAX / slot_size_) {
+    throw std::bad_array_new_length();
+  }
+  // room for the pointer is reserved first, so that push_back does not throw after the slab is allocated
+  if (slabs_.size() == slabs_.capacity()) {
+    slabs_.reserve(2 * slabs_.size() + 1);
+  }
+  void* slab = ::operator new(slot_size_ * slot_count, std::align_val_t(slot_alignment_));
+  slabs_.push_back(slab);
+
+  slab_current_ = static_cast<char*>(slab);
+  slab_end_ = slab_current_ + slot_size_ * slot_count;
+}
+
+//
+// SLAB POOL RESOURCE
+//
+
+/**
+ * Returns pool with given slot size and alignment, creates it if there is none yet.
+ */
+template <size_t SlabSize>
+SlabPool<SlabSize>* SlabPoolResource<SlabSize>::PoolFor(size_t slot_size, size_t slot_alignment) {
+  if (SlabPool<SlabSize>* pool = FindPool(slot_size, slot_alignment)) {
+    return pool;
+  }
+  pools_.push_back(std::make_unique<SlabPool<SlabSize>>(slot_size, slot_alignment));
+  return pools_.back().get();
+}
+
+/**
+ * Returns pool with given slot size and alignment, or nullptr if there is none yet.
+ */
+template <size_t SlabSize>
+SlabPool<SlabSize>* SlabPoolResource<SlabSize>::FindPool(size_t slot_size, size_t slot_alignment) const noexcept {
+  for (auto& pool : pools_) {
+    if (pool->Fits(slot_size, slot_alignment)) {
+      return pool.get();
+    }
+  }
+  return nullptr;
+}
+
+/**
+ * Returns slabs of every pool without live objects to the global heap.
+ */
+template <size_t SlabSize>
+void SlabPoolResource<SlabSize>::Release() noexcept {
+  for (auto& pool : pools_) {
+    pool->Release();
+  }
+}
@@ -0,0 +1,225 @@
+//
+// Class UnrolledList implements an unrolled double-linked list.
+//
+
+// UnrolledList has the same interface as List (see list.hpp), but each of its nodes, called chunks, stores up to
+// ChunkCapacity values in a fixed-size array instead of a single value. Traversal therefore touches one chunk per
+// ChunkCapacity values, and the cost of two pointers is shared by all values of a chunk.
+
+// Template parameter T is type of values stored in list, requirements are the same as in List, additionally move
+// constructor and move assignment of T must not throw, as insertions and erasures shift values inside and between
+// chunks, and a move failing halfway would leave a value in two slots. ChunkCapacity is the maximal number of values
+// in one chunk. Allocator is an allocator type for T, the line
+// std::allocator_traits<Allocator>::rebind_alloc<Chunk> should compile.
+
+// Values of a chunk occupy a contiguous range [first, last) of its array, so that both push_front and push_back fill
+// free slots without shifting. Insertion into a full chunk splits it in two halves, erasure merges a less than half
+// full chunk with a neighbouring one when both fit into one chunk. There are no empty chunks in the list.
+
+// Unlike List, insert, emplace and erase in the middle of the list invalidate iterators to values of the chunks they
+// change (at most three neighbouring chunks), and values are moved inside and between chunks.
+
+// UnrolledList contains chunks, which are inherited from ChunkBase class. UnrolledList itself owns only one ChunkBase
+// called "end_", end_.next points to the front chunk, end_.prev to the back one.
+
+
+#pragma once
+
+#include <memory>
+#include <iostream>
+#include <cassert>
+#include <new>
+#include <algorithm>
+#include <type_traits>
+
+//
+// DECLARATIONS
+//
+
+template <typename T, size_t ChunkCapacity = 16, typename Allocator = std::allocator<T>>
+class UnrolledList {
+  static_assert(ChunkCapacity >= 2, "Chunk must be able to store at least two values to be split");
+
+ public:
+  using value_type = T;
+  using reference = T&;
+  using const_reference = const T&;
+  using size_type = size_t;
+
+  UnrolledList();
+  UnrolledList(const UnrolledList& other);
+  UnrolledList(UnrolledList&& other) noexcept(std::is_nothrow_move_constructible_v<ChunkAllocator>);
+  explicit UnrolledList(size_t count, const T& value = T(), const Allocator& alloc = Allocator());
+  explicit UnrolledList(const Allocator& alloc);
+
+  ~UnrolledList() noexcept;
+
+  UnrolledList& operator=(const UnrolledList& other);
+  UnrolledList& operator=(UnrolledList&& other) noexcept(std::is_nothrow_move_assignable_v<ChunkAllocator>);
+
+  size_t size() const noexcept;
+
+  const T& front() const noexcept;
+  const T& back() const noexcept;
+
+  T& front() noexcept;
+  T& back() noexcept;
+
+  void clear() noexcept;
+  bool empty() const noexcept;
+
+  template <typename... Args_t>
+  void emplace_back(Args_t&& ...args);
+  template <typename... Args_t>
+  void emplace_front(Args_t&& ...args);
+
+  void push_back(const T& value);
+  void push_back(T&& value);
+
+  void push_front(const T& value);
+  void push_front(T&& value);
+
+  void pop_front() noexcept;
+  void pop_back() noexcept;
+
+  void reverse();
+  void unique();
+
+  void Print() const;
+  void CheckStatus();
+
+ private:
+  template <bool IsConst>
+  class UnitedIterator;
+
+  struct Chunk;
+  struct ChunkBase;
+
+  void CopyFromOther(const UnrolledList& other);
+  void MoveFromOther(UnrolledList&& other) noexcept(std::is_nothrow_move_assignable_v<ChunkAllocator>);
+
+  Chunk* CreateChunk(ChunkBase* next, size_t first);
+  void DestroyChunk(Chunk* chunk) noexcept;
+
+  template <typename... Args_t>
+  UnitedIterator<false> EmplaceToChunk(Chunk* chunk, size_t index, Args_t&& ...args);
+  UnitedIterator<false> EraseFromChunk(Chunk* chunk, size_t index);
+  UnitedIterator<false> EraseRangeFromChunk(Chunk* chunk, size_t first, size_t last);
+
+  void SplitChunk(Chunk* chunk);
+  void MergeWithNext(Chunk* chunk);
+  void MoveToFront(Chunk* chunk);
+  Chunk* MergeIfSmall(Chunk* chunk, size_t& offset);
+  static UnitedIterator<false> IteratorAt(Chunk* chunk, size_t offset);
+
+  static Chunk* AsChunk(ChunkBase* chunk_base);
+
+  using ChunkAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Chunk>;
+  using ChunkAllocatorTraits = std::allocator_traits<ChunkAllocator>;
+
+  ChunkBase end_;
+  ChunkAllocator alloc_;
+  size_t length_ = 0;
+
+ public:
+  using const_iterator = UnitedIterator<true>;
+  using iterator = UnitedIterator<false>;
+  using reverse_iterator = std::reverse_iterator<UnitedIterator<false>>;
+  using const_reverse_iterator = std::reverse_iterator<UnitedIterator<true>>;
+  using difference_type = typename iterator::difference_type;
+
+  iterator begin();
+  iterator end();
+
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  reverse_iterator rbegin();
+  reverse_iterator rend();
+
+  const_reverse_iterator rbegin() const;
+  const_reverse_iterator rend() const;
+
+  const_reverse_iterator crbegin() const;
+  const_reverse_iterator crend() const;
+
+  template <bool IsConst, typename... Args_t>
+  void emplace(UnitedIterator<IsConst> pos, Args_t&& ...args);
+
+  template <bool IsConst>
+  UnitedIterator<IsConst> erase(UnitedIterator<IsConst> pos);
+
+  template <bool IsConst, bool IsConstOther>
+  UnitedIterator<IsConst> erase(UnitedIterator<IsConst> first, UnitedIterator<IsConstOther> last);
+
+  template <bool IsConst>
+  UnitedIterator<IsConst> insert(UnitedIterator<IsConst> pos, const T& value);
+
+  template <bool IsConst>
+  UnitedIterator<IsConst> insert(UnitedIterator<IsConst> pos, T&& value);
+};
+
+template <typename T, size_t ChunkCapacity, typename Allocator>
+struct UnrolledList<T, ChunkCapacity, Allocator>::ChunkBase {
+  ChunkBase* next = this;
+  ChunkBase* prev = this;
+  // values are constructed in slots [first, last) of chunk, end_ has an empty range
+  size_t first = 0;
+  size_t last = 0;
+
+  ChunkBase();
+};
+
+template <typename T, size_t ChunkCapacity, typename Allocator>
+struct UnrolledList<T, ChunkCapacity, Allocator>::Chunk : public ChunkBase {
+  static_assert(std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>,
+                "Values are shifted between slots of chunks, so moving T must not throw");
+
+  alignas(T) unsigned char storage[sizeof(T) * ChunkCapacity];
+
+  explicit Chunk(size_t first_slot);
+
+  T* Slot(size_t index) noexcept;
+  T* RawSlot(size_t index) noexcept;
+  size_t Size() const noexcept;
+};
+
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+class UnrolledList<T, ChunkCapacity, Allocator>::UnitedIterator {
+ public:
+  UnitedIterator(ChunkBase* chunk, size_t index);
+
+  UnitedIterator operator++(int);
+  UnitedIterator operator--(int);
+
+  UnitedIterator& operator++();
+  UnitedIterator& operator--();
+
+  using pointer = std::conditional_t<IsConst, const T*, T*>;
+  using reference = std::conditional_t<IsConst, const T&, T&>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = T;
+
+  reference operator*() const;
+  pointer operator->() const;
+
+  template <bool IsConstOther>
+  bool operator==(const UnitedIterator<IsConstOther>& other) const;
+  template <bool IsConstOther>
+  bool operator!=(const UnitedIterator<IsConstOther>& other) const;
+
+ private:
+  ChunkBase* current_chunk_;
+  size_t index_;
+
+  friend class UnrolledList<T, ChunkCapacity, Allocator>;
+  template <bool IsConstOther>
+  friend class UnitedIterator;
+};
+
+#include "unrolled_list.ipp"
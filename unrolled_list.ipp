@@ -0,0 +1,1117 @@
+//
+// This is a .ipp file for unrolled_list.hpp. For more information check unrolled_list.hpp.
+//
+
+//
+// CHUNK CONSTRUCTORS
+//
+
+/**
+ * Default constructor
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::ChunkBase::ChunkBase() {}
+
+/**
+ * Constructs chunk without values, whose values will start from slot first_slot.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::Chunk::Chunk(size_t first_slot) {
+  this->first = first_slot;
+  this->last = first_slot;
+}
+
+/**
+ * Returns pointer to value in slot with given index, which must be constructed.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+T* UnrolledList<T, ChunkCapacity, Allocator>::Chunk::Slot(size_t index) noexcept {
+  return std::launder(RawSlot(index));
+}
+
+/**
+ * Returns pointer to storage of slot with given index, which may be past the last slot. Used to construct values in
+ * free slots and as the end of a range of slots.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+T* UnrolledList<T, ChunkCapacity, Allocator>::Chunk::RawSlot(size_t index) noexcept {
+  return reinterpret_cast<T*>(storage + index * sizeof(T));
+}
+
+/**
+ * Returns number of values in chunk.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+size_t UnrolledList<T, ChunkCapacity, Allocator>::Chunk::Size() const noexcept {
+  return this->last - this->first;
+}
+
+//
+// UNROLLED LIST CONSTRUCTORS
+//
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::UnrolledList() : alloc_(ChunkAllocator()) {}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::UnrolledList(size_t count, const T& value, const Allocator& alloc)
+    : alloc_(ChunkAllocator(alloc)) {
+  for (size_t i = 0; i < count; ++i) {
+    push_back(value);
+  }
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::UnrolledList(const UnrolledList& other) : alloc_(other.alloc_) {
+  CopyFromOther(other);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::UnrolledList(UnrolledList&& other) noexcept(
+    std::is_nothrow_move_constructible_v<ChunkAllocator>) : alloc_(std::move(other.alloc_)) {
+  MoveFromOther(std::move(other));
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::UnrolledList(const Allocator& alloc) : alloc_(ChunkAllocator(alloc)) {}
+
+//
+// UNROLLED LIST ASSIGNMENT OPERATORS
+//
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>& UnrolledList<T, ChunkCapacity, Allocator>::operator=(
+    const UnrolledList& other) {
+  if (&other == this) {
+    return *this;
+  }
+  CopyFromOther(other);
+
+  return *this;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>& UnrolledList<T, ChunkCapacity, Allocator>::operator=(
+    UnrolledList&& other) noexcept(std::is_nothrow_move_assignable_v<ChunkAllocator>) {
+  if (&other == this) {
+    return *this;
+  }
+  MoveFromOther(std::move(other));
+
+  return *this;
+}
+
+//
+// UNROLLED LIST DESTRUCTOR
+//
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+UnrolledList<T, ChunkCapacity, Allocator>::~UnrolledList() noexcept {
+  clear();
+}
+
+//
+// UNROLLED LIST FUNCTIONS
+//
+
+/**
+ * Makes this a copy of other. Values of type T are copied here, chunks of this are filled completely.
+ *
+ * @param other List to be copied from
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::CopyFromOther(const UnrolledList& other) {
+  clear();
+  for (const T& value : other) {
+    push_back(value);
+  }
+}
+
+/**
+ * Moves other into this. After usage other is an empty working list, if allocator is fine after moving. Otherwise,
+ * other is not valid.
+ *
+ * @param other List to be moved from
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::MoveFromOther(UnrolledList&& other) noexcept(
+    std::is_nothrow_move_assignable_v<ChunkAllocator>) {
+  if (&other == this) {
+    return;
+  }
+
+  clear();
+
+  if (!other.empty()) {
+    alloc_ = std::move(other.alloc_);
+
+    other.end_.next->prev = &end_;
+    other.end_.prev->next = &end_;
+    end_.next = other.end_.next;
+    end_.prev = other.end_.prev;
+    length_ = other.length_;
+
+    other.end_.next = &other.end_;
+    other.end_.prev = &other.end_;
+    other.length_ = 0;
+  }
+}
+
+/**
+ * Allocates chunk without values and links it before next.
+ *
+ * @param next Chunk or end_ before which the new chunk is linked
+ * @param first Slot from which values of new chunk will start
+ * @return Pointer to the new chunk
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::Chunk* UnrolledList<T, ChunkCapacity, Allocator>::CreateChunk(
+    ChunkBase* next,
+    size_t first) {
+  Chunk* chunk = ChunkAllocatorTraits::allocate(alloc_, 1);
+  ChunkAllocatorTraits::construct(alloc_, chunk, first);
+
+  chunk->next = next;
+  chunk->prev = next->prev;
+  next->prev->next = chunk;
+  next->prev = chunk;
+
+  return chunk;
+}
+
+/**
+ * Destroys all values of chunk, unlinks and deallocates it. Does not change length_.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::DestroyChunk(Chunk* chunk) noexcept {
+  for (size_t i = chunk->first; i < chunk->last; ++i) {
+    ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(i));
+  }
+  chunk->prev->next = chunk->next;
+  chunk->next->prev = chunk->prev;
+
+  ChunkAllocatorTraits::destroy(alloc_, chunk);
+  ChunkAllocatorTraits::deallocate(alloc_, chunk, 1);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::push_back(const T& value) {
+  emplace_back(value);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::push_back(T&& value) {
+  emplace_back(std::move(value));
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::push_front(const T& value) {
+  emplace_front(value);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::push_front(T&& value) {
+  emplace_front(std::move(value));
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+bool UnrolledList<T, ChunkCapacity, Allocator>::empty() const noexcept {
+  return length_ == 0;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+size_t UnrolledList<T, ChunkCapacity, Allocator>::size() const noexcept {
+  return length_;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+const T& UnrolledList<T, ChunkCapacity, Allocator>::front() const noexcept {
+  return *AsChunk(end_.next)->Slot(end_.next->first);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+const T& UnrolledList<T, ChunkCapacity, Allocator>::back() const noexcept {
+  return *AsChunk(end_.prev)->Slot(end_.prev->last - 1);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+T& UnrolledList<T, ChunkCapacity, Allocator>::front() noexcept {
+  return *AsChunk(end_.next)->Slot(end_.next->first);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+T& UnrolledList<T, ChunkCapacity, Allocator>::back() noexcept {
+  return *AsChunk(end_.prev)->Slot(end_.prev->last - 1);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::clear() noexcept {
+  while (end_.next != &end_) {
+    DestroyChunk(AsChunk(end_.next));
+  }
+  length_ = 0;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <typename... Args_t>
+void UnrolledList<T, ChunkCapacity, Allocator>::emplace_back(Args_t&& ...args) {
+  Chunk* back_chunk = AsChunk(end_.prev);
+  bool is_new_chunk = empty() || back_chunk->last == ChunkCapacity;
+  if (is_new_chunk) {
+    back_chunk = CreateChunk(&end_, 0);
+  }
+
+  try {
+    ChunkAllocatorTraits::construct(alloc_, back_chunk->RawSlot(back_chunk->last), std::forward<Args_t>(args)...);
+  } catch (...) {
+    if (is_new_chunk) {
+      DestroyChunk(back_chunk);
+    }
+    throw;
+  }
+  ++back_chunk->last;
+  ++length_;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <typename... Args_t>
+void UnrolledList<T, ChunkCapacity, Allocator>::emplace_front(Args_t&& ...args) {
+  Chunk* front_chunk = AsChunk(end_.next);
+  bool is_new_chunk = empty() || front_chunk->first == 0;
+  if (is_new_chunk) {
+    front_chunk = CreateChunk(end_.next, ChunkCapacity);
+  }
+
+  try {
+    ChunkAllocatorTraits::construct(alloc_,
+                                    front_chunk->RawSlot(front_chunk->first - 1),
+                                    std::forward<Args_t>(args)...);
+  } catch (...) {
+    if (is_new_chunk) {
+      DestroyChunk(front_chunk);
+    }
+    throw;
+  }
+  --front_chunk->first;
+  ++length_;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::pop_front() noexcept {
+  Chunk* front_chunk = AsChunk(end_.next);
+  ChunkAllocatorTraits::destroy(alloc_, front_chunk->Slot(front_chunk->first));
+  ++front_chunk->first;
+  if (front_chunk->Size() == 0) {
+    DestroyChunk(front_chunk);
+  }
+  --length_;
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::pop_back() noexcept {
+  Chunk* back_chunk = AsChunk(end_.prev);
+  ChunkAllocatorTraits::destroy(alloc_, back_chunk->Slot(back_chunk->last - 1));
+  --back_chunk->last;
+  if (back_chunk->Size() == 0) {
+    DestroyChunk(back_chunk);
+  }
+  --length_;
+}
+
+/**
+ * Constructs value from args before slot index of chunk. If there is a free slot right before it, at the front of chunk
+ * or at the back of the previous chunk, value is constructed there in place. Otherwise, if chunk is full, it is split
+ * first, then values between index and the end of chunk with a free slot are shifted by one.
+ *
+ * @param chunk Chunk to insert to
+ * @param index Slot of value, before which new value is inserted, must be in [chunk->first, chunk->last)
+ * @param args Arguments to construct value from
+ * @return Iterator to the inserted value
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <typename... Args_t>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<false> UnrolledList<T,
+                                                                                               ChunkCapacity,
+                                                                                               Allocator>::EmplaceToChunk(
+    Chunk* chunk,
+    size_t index,
+    Args_t&& ...args) {
+  if (index == chunk->first) {
+    if (chunk->first > 0) {
+      ChunkAllocatorTraits::construct(alloc_, chunk->RawSlot(chunk->first - 1), std::forward<Args_t>(args)...);
+      --chunk->first;
+      ++length_;
+      return UnitedIterator<false>(chunk, chunk->first);
+    }
+    if (chunk->prev != &end_ && chunk->prev->last < ChunkCapacity) {
+      Chunk* prev_chunk = AsChunk(chunk->prev);
+      ChunkAllocatorTraits::construct(alloc_, prev_chunk->RawSlot(prev_chunk->last), std::forward<Args_t>(args)...);
+      ++prev_chunk->last;
+      ++length_;
+      return UnitedIterator<false>(prev_chunk, prev_chunk->last - 1);
+    }
+  }
+
+  // value is constructed before shifting, as args may refer to values of the chunk
+  T value(std::forward<Args_t>(args)...);
+
+  if (chunk->Size() == ChunkCapacity) {
+    SplitChunk(chunk);
+    if (index >= chunk->last) {
+      index -= chunk->last;
+      chunk = AsChunk(chunk->next);
+    }
+  }
+
+  if (chunk->last < ChunkCapacity) {
+    // shift [index, last) to the back side
+    ChunkAllocatorTraits::construct(alloc_, chunk->RawSlot(chunk->last), std::move(*chunk->Slot(chunk->last - 1)));
+    ++chunk->last;
+    for (size_t i = chunk->last - 2; i > index; --i) {
+      *chunk->Slot(i) = std::move(*chunk->Slot(i - 1));
+    }
+  } else {
+    // shift [first, index) to the front side, index > first, as otherwise value was constructed in place
+    ChunkAllocatorTraits::construct(alloc_, chunk->RawSlot(chunk->first - 1), std::move(*chunk->Slot(chunk->first)));
+    --chunk->first;
+    for (size_t i = chunk->first + 1; i + 1 < index; ++i) {
+      *chunk->Slot(i) = std::move(*chunk->Slot(i + 1));
+    }
+    --index;
+  }
+  *chunk->Slot(index) = std::move(value);
+  ++length_;
+
+  return UnitedIterator<false>(chunk, index);
+}
+
+/**
+ * Destroys value in slot index of chunk. Values on the shorter side of index are shifted by one to fill the gap.
+ * Empty chunk is deallocated, less than half full chunk is merged with a neighbouring one if they fit in one chunk.
+ *
+ * @param chunk Chunk to erase from
+ * @param index Slot of value to be erased, must be in [chunk->first, chunk->last)
+ * @return Iterator to the value, which followed the erased one
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<false> UnrolledList<T,
+                                                                                               ChunkCapacity,
+                                                                                               Allocator>::EraseFromChunk(
+    Chunk* chunk,
+    size_t index) {
+  // position of the following value is kept as offset from chunk->first, as shifting and merging change slots
+  size_t next_offset = index - chunk->first;
+  if (index - chunk->first < chunk->last - index - 1) {
+    for (size_t i = index; i > chunk->first; --i) {
+      *chunk->Slot(i) = std::move(*chunk->Slot(i - 1));
+    }
+    ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(chunk->first));
+    ++chunk->first;
+  } else {
+    for (size_t i = index; i + 1 < chunk->last; ++i) {
+      *chunk->Slot(i) = std::move(*chunk->Slot(i + 1));
+    }
+    ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(chunk->last - 1));
+    --chunk->last;
+  }
+  --length_;
+
+  if (chunk->Size() == 0) {
+    ChunkBase* next = chunk->next;
+    DestroyChunk(chunk);
+    return UnitedIterator<false>(next, next->first);
+  }
+
+  chunk = MergeIfSmall(chunk, next_offset);
+  return IteratorAt(chunk, next_offset);
+}
+
+/**
+ * Destroys values in slots [first, last) of chunk. Values on the shorter side of the range are shifted once by its
+ * length to fill the gap. Empty chunk is deallocated, less than half full chunk is merged as in EraseFromChunk.
+ *
+ * @param chunk Chunk to erase from
+ * @param first Slot of the first value to be erased, must be in [chunk->first, chunk->last)
+ * @param last Slot after the last value to be erased, must be in (first, chunk->last]
+ * @return Iterator to the value, which followed the erased ones
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<false> UnrolledList<T,
+                                                                                               ChunkCapacity,
+                                                                                               Allocator>::EraseRangeFromChunk(
+    Chunk* chunk,
+    size_t first,
+    size_t last) {
+  size_t count = last - first;
+  length_ -= count;
+  if (count == chunk->Size()) {
+    ChunkBase* next = chunk->next;
+    DestroyChunk(chunk);
+    return UnitedIterator<false>(next, next->first);
+  }
+
+  size_t next_offset = first - chunk->first;
+  if (first - chunk->first < chunk->last - last) {
+    for (size_t i = first; i > chunk->first; --i) {
+      *chunk->Slot(i - 1 + count) = std::move(*chunk->Slot(i - 1));
+    }
+    for (size_t i = chunk->first; i < chunk->first + count; ++i) {
+      ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(i));
+    }
+    chunk->first += count;
+  } else {
+    for (size_t i = last; i < chunk->last; ++i) {
+      *chunk->Slot(i - count) = std::move(*chunk->Slot(i));
+    }
+    for (size_t i = chunk->last - count; i < chunk->last; ++i) {
+      ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(i));
+    }
+    chunk->last -= count;
+  }
+
+  chunk = MergeIfSmall(chunk, next_offset);
+  return IteratorAt(chunk, next_offset);
+}
+
+/**
+ * If chunk is less than half full, merges it with the next chunk, or else with the previous one, if they fit into one
+ * chunk. Returns the chunk, which holds the values of chunk afterwards, and adds to offset the number of values
+ * before them in it, so that offset from the first value of the returned chunk points to the same value.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::Chunk* UnrolledList<T, ChunkCapacity, Allocator>::MergeIfSmall(
+    Chunk* chunk,
+    size_t& offset) {
+  if (chunk->Size() < ChunkCapacity / 2) {
+    if (chunk->next != &end_ && chunk->Size() + AsChunk(chunk->next)->Size() <= ChunkCapacity) {
+      MergeWithNext(chunk);
+    } else if (chunk->prev != &end_ && chunk->Size() + AsChunk(chunk->prev)->Size() <= ChunkCapacity) {
+      chunk = AsChunk(chunk->prev);
+      offset += chunk->Size();
+      MergeWithNext(chunk);
+    }
+  }
+  return chunk;
+}
+
+/**
+ * Moves back half of values of full chunk to a new chunk, which is linked after it.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::SplitChunk(Chunk* chunk) {
+  size_t middle = chunk->first + chunk->Size() / 2;
+  Chunk* new_chunk = CreateChunk(chunk->next, 0);
+
+  try {
+    for (size_t i = middle; i < chunk->last; ++i) {
+      ChunkAllocatorTraits::construct(alloc_, new_chunk->RawSlot(new_chunk->last), std::move(*chunk->Slot(i)));
+      ++new_chunk->last;
+    }
+  } catch (...) {
+    DestroyChunk(new_chunk);
+    throw;
+  }
+
+  for (size_t i = middle; i < chunk->last; ++i) {
+    ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(i));
+  }
+  chunk->last = middle;
+}
+
+/**
+ * Moves all values of the next chunk to the back of chunk and deallocates the next chunk. Values of both chunks must
+ * fit into one chunk.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::MergeWithNext(Chunk* chunk) {
+  Chunk* next_chunk = AsChunk(chunk->next);
+  if (chunk->last + next_chunk->Size() > ChunkCapacity) {
+    MoveToFront(chunk);
+  }
+
+  while (next_chunk->first != next_chunk->last) {
+    ChunkAllocatorTraits::construct(alloc_,
+                                    chunk->RawSlot(chunk->last),
+                                    std::move(*next_chunk->Slot(next_chunk->first)));
+    ++chunk->last;
+    ChunkAllocatorTraits::destroy(alloc_, next_chunk->Slot(next_chunk->first));
+    ++next_chunk->first;
+  }
+  DestroyChunk(next_chunk);
+}
+
+/**
+ * Moves values of chunk to slots [0, size).
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::MoveToFront(Chunk* chunk) {
+  // every destination slot is either before first or was already moved from and destroyed
+  size_t size = chunk->Size();
+  for (size_t i = 0; i < size; ++i) {
+    ChunkAllocatorTraits::construct(alloc_, chunk->RawSlot(i), std::move(*chunk->Slot(chunk->first + i)));
+    ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(chunk->first + i));
+  }
+  chunk->first = 0;
+  chunk->last = size;
+}
+
+/**
+ * Returns iterator to value with given offset from the first value of chunk. If offset equals the size of chunk,
+ * returns iterator to the first value of the next chunk.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<false> UnrolledList<T,
+                                                                                               ChunkCapacity,
+                                                                                               Allocator>::IteratorAt(
+    Chunk* chunk,
+    size_t offset) {
+  if (offset == chunk->Size()) {
+    return UnitedIterator<false>(chunk->next, chunk->next->first);
+  }
+  return UnitedIterator<false>(chunk, chunk->first + offset);
+}
+
+//
+// ITERATOR CLASS
+//
+
+/**
+ * Increments iterator. Returns reference to itself after incrementing.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst>& UnrolledList<T,
+                                                                                                  ChunkCapacity,
+                                                                                                  Allocator>::UnitedIterator<
+    IsConst>::operator++() {
+  ++index_;
+  if (index_ == current_chunk_->last) {
+    current_chunk_ = current_chunk_->next;
+    index_ = current_chunk_->first;
+  }
+  return *this;
+}
+
+/**
+ * Decrements iterator. Returns reference to itself after decrementing.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst>& UnrolledList<T,
+                                                                                                  ChunkCapacity,
+                                                                                                  Allocator>::UnitedIterator<
+    IsConst>::operator--() {
+  if (index_ == current_chunk_->first) {
+    current_chunk_ = current_chunk_->prev;
+    index_ = current_chunk_->last;
+  }
+  --index_;
+  return *this;
+}
+
+/**
+ * Increments iterator. Returns copy of itself before incrementing.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst> UnrolledList<T,
+                                                                                                 ChunkCapacity,
+                                                                                                 Allocator>::UnitedIterator<
+    IsConst>::operator++(int) {
+  auto copy = *this;
+  ++*this;
+  return copy;
+}
+
+/**
+ * Decrements iterator. Returns copy of itself before decrementing.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst> UnrolledList<T,
+                                                                                                 ChunkCapacity,
+                                                                                                 Allocator>::UnitedIterator<
+    IsConst>::operator--(int) {
+  auto copy = *this;
+  --*this;
+  return copy;
+}
+
+/**
+ * Constructs iterator from chunk and slot index in it.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+UnrolledList<T, ChunkCapacity, Allocator>::UnitedIterator<IsConst>::UnitedIterator(ChunkBase* chunk, size_t index)
+    : current_chunk_(chunk), index_(index) {}
+
+/**
+ * Returns reference to a value in iterator. Reference is const when iterator is const, and not const otherwise.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst>::reference UnrolledList<T,
+                                                                                                            ChunkCapacity,
+                                                                                                            Allocator>::UnitedIterator<
+    IsConst>::operator*() const {
+  return *AsChunk(current_chunk_)->Slot(index_);
+}
+
+/**
+ * Returns pointer to a value in iterator. Pointer is const when iterator is const, and not const otherwise.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst>::pointer UnrolledList<T,
+                                                                                                          ChunkCapacity,
+                                                                                                          Allocator>::UnitedIterator<
+    IsConst>::operator->() const {
+  return AsChunk(current_chunk_)->Slot(index_);
+}
+
+/**
+ * Returns true if iterators point at the same value, false otherwise.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+template <bool IsConstOther>
+bool UnrolledList<T, ChunkCapacity, Allocator>::UnitedIterator<IsConst>::operator==(
+    const UnitedIterator<IsConstOther>& other) const {
+  return current_chunk_ == other.current_chunk_ && index_ == other.index_;
+}
+
+/**
+ * Returns false if iterators point at the same value, true otherwise.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+template <bool IsConstOther>
+bool UnrolledList<T, ChunkCapacity, Allocator>::UnitedIterator<IsConst>::operator!=(
+    const UnitedIterator<IsConstOther>& other) const {
+  return !(*this == other);
+}
+
+//
+// UNROLLED LIST ITERATORS
+//
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::iterator UnrolledList<T, ChunkCapacity, Allocator>::begin() {
+  return iterator(end_.next, end_.next->first);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::iterator UnrolledList<T, ChunkCapacity, Allocator>::end() {
+  return iterator(&end_, 0);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_iterator UnrolledList<T,
+                                                                                ChunkCapacity,
+                                                                                Allocator>::cbegin() const {
+  return const_iterator(end_.next, end_.next->first);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_iterator UnrolledList<T,
+                                                                                ChunkCapacity,
+                                                                                Allocator>::cend() const {
+  return const_iterator(const_cast<ChunkBase*>(&end_), 0);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_iterator UnrolledList<T,
+                                                                                ChunkCapacity,
+                                                                                Allocator>::begin() const {
+  return cbegin();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_iterator UnrolledList<T,
+                                                                                ChunkCapacity,
+                                                                                Allocator>::end() const {
+  return cend();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::reverse_iterator UnrolledList<T,
+                                                                                  ChunkCapacity,
+                                                                                  Allocator>::rbegin() {
+  return reverse_iterator(end());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::reverse_iterator UnrolledList<T,
+                                                                                  ChunkCapacity,
+                                                                                  Allocator>::rend() {
+  return reverse_iterator(begin());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_reverse_iterator UnrolledList<T,
+                                                                                        ChunkCapacity,
+                                                                                        Allocator>::crbegin() const {
+  return const_reverse_iterator(cend());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_reverse_iterator UnrolledList<T,
+                                                                                        ChunkCapacity,
+                                                                                        Allocator>::crend() const {
+  return const_reverse_iterator(cbegin());
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_reverse_iterator UnrolledList<T,
+                                                                                        ChunkCapacity,
+                                                                                        Allocator>::rbegin() const {
+  return crbegin();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::const_reverse_iterator UnrolledList<T,
+                                                                                        ChunkCapacity,
+                                                                                        Allocator>::rend() const {
+  return crend();
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Invalidates iterators to values of the chunk pos points to and of the next chunk.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst, typename... Args_t>
+void UnrolledList<T, ChunkCapacity, Allocator>::emplace(UnitedIterator<IsConst> pos, Args_t&& ...args) {
+  if (pos.current_chunk_ == &end_) {
+    emplace_back(std::forward<Args_t>(args)...);
+  } else {
+    EmplaceToChunk(AsChunk(pos.current_chunk_), pos.index_, std::forward<Args_t>(args)...);
+  }
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Invalidates iterators to values of the chunk pos points to and of the next chunk.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst> UnrolledList<T,
+                                                                                                 ChunkCapacity,
+                                                                                                 Allocator>::insert(
+    UnitedIterator<IsConst> pos,
+    const T& value) {
+  if (pos.current_chunk_ == &end_) {
+    emplace_back(value);
+    return UnitedIterator<IsConst>(end_.prev, end_.prev->last - 1);
+  }
+  auto it = EmplaceToChunk(AsChunk(pos.current_chunk_), pos.index_, value);
+  return UnitedIterator<IsConst>(it.current_chunk_, it.index_);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Invalidates iterators to values of the chunk pos points to and of the next chunk.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst> UnrolledList<T,
+                                                                                                 ChunkCapacity,
+                                                                                                 Allocator>::insert(
+    UnitedIterator<IsConst> pos,
+    T&& value) {
+  if (pos.current_chunk_ == &end_) {
+    emplace_back(std::move(value));
+    return UnitedIterator<IsConst>(end_.prev, end_.prev->last - 1);
+  }
+  auto it = EmplaceToChunk(AsChunk(pos.current_chunk_), pos.index_, std::move(value));
+  return UnitedIterator<IsConst>(it.current_chunk_, it.index_);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Invalidates iterators to values of the chunk pos points to and of its neighbours.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst> UnrolledList<T,
+                                                                                                 ChunkCapacity,
+                                                                                                 Allocator>::erase(
+    UnitedIterator<IsConst> pos) {
+  auto it = EraseFromChunk(AsChunk(pos.current_chunk_), pos.index_);
+  return UnitedIterator<IsConst>(it.current_chunk_, it.index_);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Chunks inside the range are destroyed whole, values of the boundary chunks are cut from their back and front sides
+ * without shifting, or shifted once if the range is inside one chunk. Then the boundary chunks are merged if they are
+ * less than half full. Invalidates iterators to values of the boundary chunks and of their neighbours.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+template <bool IsConst, bool IsConstOther>
+typename UnrolledList<T, ChunkCapacity, Allocator>::template UnitedIterator<IsConst> UnrolledList<T,
+                                                                                                 ChunkCapacity,
+                                                                                                 Allocator>::erase(
+    UnitedIterator<IsConst> first,
+    UnitedIterator<IsConstOther> last) {
+  if (first == last) {
+    return first;
+  }
+  ChunkBase* last_chunk = last.current_chunk_;
+  if (first.current_chunk_ == last_chunk) {
+    auto it = EraseRangeFromChunk(AsChunk(last_chunk), first.index_, last.index_);
+    return UnitedIterator<IsConst>(it.current_chunk_, it.index_);
+  }
+
+  // values of the first chunk from first.index_ and of the last chunk before last.index_ are at the ends of their
+  // chunks, so they are destroyed without shifting the rest
+  Chunk* first_chunk = AsChunk(first.current_chunk_);
+  ChunkBase* current_chunk = first_chunk->next;
+  if (first.index_ == first_chunk->first) {
+    length_ -= first_chunk->Size();
+    DestroyChunk(first_chunk);
+    first_chunk = nullptr;
+  } else {
+    for (size_t i = first.index_; i < first_chunk->last; ++i) {
+      ChunkAllocatorTraits::destroy(alloc_, first_chunk->Slot(i));
+    }
+    length_ -= first_chunk->last - first.index_;
+    first_chunk->last = first.index_;
+  }
+
+  while (current_chunk != last_chunk) {
+    Chunk* chunk = AsChunk(current_chunk);
+    current_chunk = current_chunk->next;
+    length_ -= chunk->Size();
+    DestroyChunk(chunk);
+  }
+
+  if (last_chunk == &end_) {
+    if (first_chunk != nullptr) {
+      size_t offset = 0;
+      MergeIfSmall(first_chunk, offset);
+    }
+    return UnitedIterator<IsConst>(&end_, 0);
+  }
+
+  Chunk* chunk = AsChunk(last_chunk);
+  for (size_t i = chunk->first; i < last.index_; ++i) {
+    ChunkAllocatorTraits::destroy(alloc_, chunk->Slot(i));
+  }
+  length_ -= last.index_ - chunk->first;
+  chunk->first = last.index_;
+
+  // the boundary chunks are neighbours now, the value following the range is the first one of the last chunk
+  size_t offset = 0;
+  if (first_chunk != nullptr && first_chunk->Size() < ChunkCapacity / 2 &&
+      first_chunk->Size() + chunk->Size() <= ChunkCapacity) {
+    offset = first_chunk->Size();
+    MergeWithNext(first_chunk);
+    chunk = first_chunk;
+  } else {
+    chunk = MergeIfSmall(chunk, offset);
+  }
+  auto it = IteratorAt(chunk, offset);
+  return UnitedIterator<IsConst>(it.current_chunk_, it.index_);
+}
+
+//
+// OTHER UNROLLED LIST FUNCTIONS
+//
+
+/**
+ * Prints length and values in order they are in list.
+ * For this function to work properly std::cout should be able to print value of type T.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::Print() const {
+  std::cout << "length: " << length_ << "\n";
+  std::cout << "values:\n";
+
+  for (const T& value : *this) {
+    std::cout << value << " ";
+  }
+  std::cout << std::endl;
+}
+
+/**
+ * Checks if list is not "broken".
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::CheckStatus() {
+  size_t counter = 0;
+  ChunkBase* current_chunk = end_.next;
+  const ChunkBase* prev_chunk = &end_;
+  while (current_chunk != &end_) {
+    assert(current_chunk->prev == prev_chunk);
+    assert(current_chunk->first < current_chunk->last);
+    assert(current_chunk->last <= ChunkCapacity);
+    counter += current_chunk->last - current_chunk->first;
+
+    prev_chunk = current_chunk;
+    current_chunk = current_chunk->next;
+  }
+  assert(end_.prev == prev_chunk);
+  assert(counter == length_);
+}
+
+/**
+ * Unsafe cast from base class pointer ChunkBase* to derived Chunk*.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+typename UnrolledList<T, ChunkCapacity, Allocator>::Chunk* UnrolledList<T, ChunkCapacity, Allocator>::AsChunk(
+    ChunkBase* chunk_base) {
+  return static_cast<Chunk*>(chunk_base);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Reverses order of chunks and order of values inside every chunk, values are swapped.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::reverse() {
+  ChunkBase* current_chunk = &end_;
+  do {
+    std::swap(current_chunk->next, current_chunk->prev);
+    if (current_chunk != &end_) {
+      Chunk* chunk = AsChunk(current_chunk);
+      std::reverse(chunk->Slot(chunk->first), chunk->RawSlot(chunk->last));
+    }
+    current_chunk = current_chunk->next;
+  } while (current_chunk != &end_);
+}
+
+/**
+ * Reference C++17 standard at https://en.cppreference.com/w/cpp/container/list.
+ * Leaves the last element of every group of adjacent equal elements, as List does. Kept values are moved to the front
+ * side, then the rest is erased from the back.
+ */
+template <typename T, size_t ChunkCapacity, typename Allocator>
+void UnrolledList<T, ChunkCapacity, Allocator>::unique() {
+  if (empty()) {
+    return;
+  }
+
+  // an element is kept if the next one differs from it; kept values never overtake the compared ones
+  size_t kept = 0;
+  iterator next_kept = begin();
+  for (iterator current = begin(); current != end(); ++current) {
+    iterator next = std::next(current);
+    if (next == end() || !(*next == *current)) {
+      if (next_kept != current) {
+        *next_kept = std::move(*current);
+      }
+      ++next_kept;
+      ++kept;
+    }
+  }
+
+  while (length_ > kept) {
+    pop_back();
+  }
+}